@@ -0,0 +1,235 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_IO_BUFFERED_READER_HPP
+#define CRYPTO3_MARSHALLING_IO_BUFFERED_READER_HPP
+
+#include <algorithm>
+#include <vector>
+#include <iterator>
+#include <utility>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#include <boost/assert.hpp>
+
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/marshalling/io/device.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace io {
+
+                /// @brief Reads marshalling types from a byte device through one large buffer.
+                /// @details Fixed length values which fit into the buffer are decoded in
+                ///     place with random access, all other ones through a single-pass
+                ///     input iterator. Device is any type with
+                ///     std::size_t read(std::uint8_t *data, std::size_t size), returning
+                ///     zero once exhausted, see device.hpp. The device is consumed ahead
+                ///     of the decoded values by up to one buffer.
+                template<typename Device>
+                class buffered_reader {
+                public:
+                    /// @brief Single-pass input iterator consuming the reader's buffer.
+                    /// @details A default constructed iterator is the end of the device.
+                    class iterator {
+                    public:
+                        using iterator_category = std::input_iterator_tag;
+                        using value_type = std::uint8_t;
+                        using difference_type = std::ptrdiff_t;
+                        using pointer = const std::uint8_t *;
+                        using reference = std::uint8_t;
+
+                        class proxy {
+                        public:
+                            std::uint8_t operator*() const {
+                                return value_;
+                            }
+
+                        private:
+                            friend class iterator;
+
+                            explicit proxy(std::uint8_t value) : value_(value) {
+                            }
+
+                            std::uint8_t value_;
+                        };
+
+                        iterator() = default;
+
+                        explicit iterator(buffered_reader &reader) : reader_(&reader) {
+                        }
+
+                        std::uint8_t operator*() const {
+                            return reader_->peek();
+                        }
+
+                        iterator &operator++() {
+                            reader_->skip();
+                            return *this;
+                        }
+
+                        proxy operator++(int) {
+                            proxy result(**this);
+                            ++*this;
+                            return result;
+                        }
+
+                        bool operator==(const iterator &other) const {
+                            return at_end() == other.at_end();
+                        }
+
+                        bool operator!=(const iterator &other) const {
+                            return !(*this == other);
+                        }
+
+                    private:
+                        bool at_end() const {
+                            return reader_ == nullptr || !reader_->available(1);
+                        }
+
+                        buffered_reader *reader_ = nullptr;
+                    };
+
+                    explicit buffered_reader(Device device, 
+                                             std::size_t buffer_size = default_buffer_size) : 
+                        device_(std::move(device)), buffer_(buffer_size) {
+                        BOOST_ASSERT(buffer_size > 0);
+                    }
+
+                    buffered_reader(const buffered_reader &) = delete;
+                    buffered_reader &operator=(const buffered_reader &) = delete;
+
+                    iterator input() {
+                        return iterator(*this);
+                    }
+
+                    /// @return false if the device is exhausted before size bytes are buffered.
+                    /// @pre size is not larger than the buffer.
+                    bool available(std::size_t size) {
+                        BOOST_ASSERT(size <= buffer_.size());
+                        if (size_ - position_ >= size) {
+                            return true;
+                        }
+
+                        std::memmove(buffer_.data(), buffer_.data() + position_, size_ - position_);
+                        size_ -= position_;
+                        position_ = 0;
+                        while (size_ < size) {
+                            const std::size_t read_size = 
+                                device_.read(buffer_.data() + size_, buffer_.size() - size_);
+                            if (read_size == 0) {
+                                return false;
+                            }
+                            size_ += read_size;
+                        }
+                        return true;
+                    }
+
+                    /// @return The next byte, or zero and an underflow mark once the
+                    ///     device is exhausted.
+                    std::uint8_t peek() {
+                        if (!available(1)) {
+                            underflow_ = true;
+                            return 0x00;
+                        }
+                        return buffer_[position_];
+                    }
+
+                    void skip() {
+                        if (position_ < size_) {
+                            position_++;
+                        }
+                    }
+
+                    /// @brief Decode the next value from the device.
+                    /// @param[in] size Maximum number of bytes the value may span, normally
+                    ///     the bytes left in the input. Size prefixes read from the device
+                    ///     are checked against it, so it bounds what untrusted input can
+                    ///     make the value allocate. It must be exact for types which consume
+                    ///     all available data, such as an array_list without a size prefix.
+                    /// @return not_enough_data if the device is exhausted before the value is
+                    ///     complete.
+                    template<typename TMarshalling>
+                    nil::marshalling::status_type read(TMarshalling &value, 
+                                                       std::size_t size) {
+                        const std::size_t length = TMarshalling::max_length();
+                        if (TMarshalling::min_length() == length && length <= buffer_.size()) {
+                            if (length > size || !available(length)) {
+                                return nil::marshalling::status_type::not_enough_data;
+                            }
+                            const std::uint8_t *first = buffer_.data() + position_;
+                            const std::uint8_t *read_iter = first;
+                            nil::marshalling::status_type status = value.read(read_iter, length);
+                            position_ += static_cast<std::size_t>(read_iter - first);
+                            return status;
+                        }
+
+                        underflow_ = false;
+                        iterator read_iter = input();
+                        nil::marshalling::status_type status = value.read(read_iter, size);
+                        if (status == nil::marshalling::status_type::success && underflow_) {
+                            return nil::marshalling::status_type::not_enough_data;
+                        }
+                        return status;
+                    }
+
+                private:
+                    Device device_;
+                    std::vector<std::uint8_t> buffer_;
+                    std::size_t position_ = 0;
+                    std::size_t size_ = 0;
+                    bool underflow_ = false;
+                };
+
+                /// @brief Read a single marshalling value from device.
+                /// @details Fixed length values which fit into buffer_size use a buffer of
+                ///     exactly their length, so nothing past the value is consumed. Other
+                ///     values may consume up to buffer_size bytes past their end; use
+                ///     buffered_reader to read several values from one device.
+                /// @param[in] size Bytes available on device, such as the file size. See
+                ///     buffered_reader::read.
+                /// @throws std::system_error if the device fails.
+                template<typename TMarshalling, 
+                         typename Device>
+                nil::marshalling::status_type read_buffered(TMarshalling &value, 
+                                                            Device device, 
+                                                            std::size_t size, 
+                                                            std::size_t buffer_size = default_buffer_size) {
+                    if (TMarshalling::min_length() == TMarshalling::max_length()) {
+                        buffer_size = std::max<std::size_t>(
+                            std::min(buffer_size, TMarshalling::max_length()), 1);
+                    }
+                    buffered_reader<Device> reader(std::move(device), buffer_size);
+                    return reader.read(value, size);
+                }
+            }    // namespace io
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_IO_BUFFERED_READER_HPP
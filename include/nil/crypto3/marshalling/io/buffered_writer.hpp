@@ -0,0 +1,194 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_IO_BUFFERED_WRITER_HPP
+#define CRYPTO3_MARSHALLING_IO_BUFFERED_WRITER_HPP
+
+#include <algorithm>
+#include <vector>
+#include <iterator>
+#include <utility>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#include <boost/assert.hpp>
+
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/marshalling/io/device.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace io {
+
+                /// @brief Writes marshalling types to a byte device through one large buffer.
+                /// @details Values which fit into the buffer are encoded in place with
+                ///     random access, larger ones are streamed element by element through
+                ///     an output iterator. The device only sees writes of the whole buffer.
+                ///     Device is any type with write(const std::uint8_t *data, std::size_t size)
+                ///     and flush(), see device.hpp.
+                ///     Remaining bytes are flushed on destruction, where device errors are
+                ///     ignored; call flush() to have them reported.
+                template<typename Device>
+                class buffered_writer {
+                public:
+                    /// @brief Output iterator appending to the writer's buffer.
+                    class iterator {
+                    public:
+                        using iterator_category = std::output_iterator_tag;
+                        using value_type = void;
+                        using difference_type = std::ptrdiff_t;
+                        using pointer = void;
+                        using reference = void;
+
+                        explicit iterator(buffered_writer &writer) : writer_(&writer) {
+                        }
+
+                        iterator &operator=(std::uint8_t value) {
+                            writer_->put(value);
+                            return *this;
+                        }
+
+                        iterator &operator*() {
+                            return *this;
+                        }
+
+                        iterator &operator++() {
+                            return *this;
+                        }
+
+                        iterator operator++(int) {
+                            return *this;
+                        }
+
+                    private:
+                        buffered_writer *writer_;
+                    };
+
+                    explicit buffered_writer(Device device, 
+                                             std::size_t buffer_size = default_buffer_size) : 
+                        device_(std::move(device)), buffer_(buffer_size) {
+                        BOOST_ASSERT(buffer_size > 0);
+                    }
+
+                    ~buffered_writer() {
+                        try {
+                            flush();
+                        } catch (...) {
+                        }
+                    }
+
+                    buffered_writer(const buffered_writer &) = delete;
+                    buffered_writer &operator=(const buffered_writer &) = delete;
+
+                    iterator output() {
+                        return iterator(*this);
+                    }
+
+                    void put(std::uint8_t value) {
+                        if (size_ == buffer_.size()) {
+                            flush_buffer();
+                        }
+                        buffer_[size_++] = value;
+                    }
+
+                    void write_bytes(const std::uint8_t *data, std::size_t size) {
+                        if (size > buffer_.size() - size_) {
+                            flush_buffer();
+                        }
+                        if (size >= buffer_.size()) {
+                            device_.write(data, size);
+                            return;
+                        }
+                        std::memcpy(buffer_.data() + size_, data, size);
+                        size_ += size;
+                    }
+
+                    /// @brief Append the encoding of a filled marshalling value.
+                    /// @details If the value is larger than the buffer and its encoding
+                    ///     fails, the bytes preceding the failure may already be written.
+                    template<typename TMarshalling>
+                    nil::marshalling::status_type write(const TMarshalling &value) {
+                        const std::size_t length = value.length();
+                        if (length > buffer_.size()) {
+                            iterator write_iter = output();
+                            return value.write(write_iter, length);
+                        }
+
+                        if (length > buffer_.size() - size_) {
+                            flush_buffer();
+                        }
+                        // encoders such as curve_element's OR flags into a zeroed output
+                        std::fill_n(buffer_.data() + size_, length, 0x00);
+                        std::uint8_t *write_iter = buffer_.data() + size_;
+                        nil::marshalling::status_type status = value.write(write_iter, length);
+                        if (status == nil::marshalling::status_type::success) {
+                            size_ += length;
+                        }
+                        return status;
+                    }
+
+                    void flush() {
+                        flush_buffer();
+                        device_.flush();
+                    }
+
+                private:
+                    void flush_buffer() {
+                        if (size_ != 0) {
+                            device_.write(buffer_.data(), size_);
+                            size_ = 0;
+                        }
+                    }
+
+                    Device device_;
+                    std::vector<std::uint8_t> buffer_;
+                    std::size_t size_ = 0;
+                };
+
+                /// @brief Write a filled marshalling value to device and flush it.
+                /// @details The buffer is never larger than the encoding of value.
+                /// @throws std::system_error if the device fails.
+                template<typename TMarshalling, 
+                         typename Device>
+                nil::marshalling::status_type write_buffered(const TMarshalling &value, 
+                                                             Device device, 
+                                                             std::size_t buffer_size = default_buffer_size) {
+                    buffered_writer<Device> writer(std::move(device), 
+                        std::max<std::size_t>(std::min(buffer_size, value.length()), 1));
+
+                    nil::marshalling::status_type status = writer.write(value);
+                    if (status == nil::marshalling::status_type::success) {
+                        writer.flush();
+                    }
+                    return status;
+                }
+            }    // namespace io
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_IO_BUFFERED_WRITER_HPP
@@ -0,0 +1,165 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_IO_DEVICE_HPP
+#define CRYPTO3_MARSHALLING_IO_DEVICE_HPP
+
+#include <istream>
+#include <ostream>
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include <cerrno>
+#include <system_error>
+
+#include <unistd.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace io {
+
+                /// @brief Default size of the buffers used by buffered_writer and buffered_reader.
+                constexpr std::size_t default_buffer_size = 1 << 20;
+
+                /// @brief Byte device on top of a std::ostream or std::istream.
+                /// @details write(data, size) stores all bytes, read(data, size) returns
+                ///     the number of bytes stored in data, zero once the stream is exhausted.
+                ///     Failures of the underlying stream throw std::system_error.
+                class ostream_device {
+                public:
+                    explicit ostream_device(std::ostream &stream) : stream_(stream) {
+                    }
+
+                    void write(const std::uint8_t *data, std::size_t size) {
+                        stream_.write(reinterpret_cast<const char *>(data), 
+                                      static_cast<std::streamsize>(size));
+                        if (!stream_) {
+                            throw std::system_error(std::make_error_code(std::io_errc::stream));
+                        }
+                    }
+
+                    void flush() {
+                        if (!stream_.flush()) {
+                            throw std::system_error(std::make_error_code(std::io_errc::stream));
+                        }
+                    }
+
+                private:
+                    std::ostream &stream_;
+                };
+
+                class istream_device {
+                public:
+                    explicit istream_device(std::istream &stream) : stream_(stream) {
+                    }
+
+                    std::size_t read(std::uint8_t *data, std::size_t size) {
+                        stream_.read(reinterpret_cast<char *>(data), 
+                                     static_cast<std::streamsize>(size));
+                        if (stream_.bad()) {
+                            throw std::system_error(std::make_error_code(std::io_errc::stream));
+                        }
+                        return static_cast<std::size_t>(stream_.gcount());
+                    }
+
+                private:
+                    std::istream &stream_;
+                };
+
+                /// @brief Byte device on top of a C stdio stream. The stream is not closed.
+                class file_device {
+                public:
+                    explicit file_device(std::FILE *file) : file_(file) {
+                    }
+
+                    void write(const std::uint8_t *data, std::size_t size) {
+                        if (std::fwrite(data, 1, size, file_) != size) {
+                            throw std::system_error(errno, std::generic_category());
+                        }
+                    }
+
+                    std::size_t read(std::uint8_t *data, std::size_t size) {
+                        const std::size_t read_size = std::fread(data, 1, size, file_);
+                        if (read_size == 0 && std::ferror(file_)) {
+                            throw std::system_error(errno, std::generic_category());
+                        }
+                        return read_size;
+                    }
+
+                    void flush() {
+                        if (std::fflush(file_) != 0) {
+                            throw std::system_error(errno, std::generic_category());
+                        }
+                    }
+
+                private:
+                    std::FILE *file_;
+                };
+
+                /// @brief Byte device on top of a POSIX file descriptor. The descriptor
+                ///     is not closed. Short transfers and EINTR are retried.
+                class fd_device {
+                public:
+                    explicit fd_device(int fd) : fd_(fd) {
+                    }
+
+                    void write(const std::uint8_t *data, std::size_t size) {
+                        while (size > 0) {
+                            const ::ssize_t written = ::write(fd_, data, size);
+                            if (written < 0) {
+                                if (errno == EINTR) {
+                                    continue;
+                                }
+                                throw std::system_error(errno, std::generic_category());
+                            }
+                            data += written;
+                            size -= static_cast<std::size_t>(written);
+                        }
+                    }
+
+                    std::size_t read(std::uint8_t *data, std::size_t size) {
+                        while (true) {
+                            const ::ssize_t read_size = ::read(fd_, data, size);
+                            if (read_size >= 0) {
+                                return static_cast<std::size_t>(read_size);
+                            }
+                            if (errno != EINTR) {
+                                throw std::system_error(errno, std::generic_category());
+                            }
+                        }
+                    }
+
+                    void flush() {
+                    }
+
+                private:
+                    int fd_;
+                };
+            }    // namespace io
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_IO_DEVICE_HPP
@@ -0,0 +1,158 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_IO_MAPPED_FILE_HPP
+#define CRYPTO3_MARSHALLING_IO_MAPPED_FILE_HPP
+
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include <cerrno>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace io {
+
+                /// @brief Read-only shared mapping of a whole file.
+                /// @details The mapping is an input source for marshalling types: begin()
+                ///     and end() are random access iterators, so read() and the vector
+                ///     decoders work on the mapped pages directly, with no copy into a heap
+                ///     buffer. The mapping is shared, so concurrent processes reading the
+                ///     same file share its page cache pages.
+                class mapped_file {
+                public:
+                    /// @brief Expected access pattern, passed to madvise.
+                    enum class access_pattern {
+                        normal, 
+                        sequential, 
+                        random
+                    };
+
+                    /// @throws std::system_error if the file cannot be opened or mapped.
+                    explicit mapped_file(const std::string &path, 
+                                         access_pattern pattern = access_pattern::sequential) {
+                        int fd = ::open(path.c_str(), O_RDONLY);
+                        if (fd < 0) {
+                            throw std::system_error(errno, std::generic_category(), path);
+                        }
+
+                        struct stat file_stat;
+                        if (::fstat(fd, &file_stat) != 0) {
+                            int error = errno;
+                            ::close(fd);
+                            throw std::system_error(error, std::generic_category(), path);
+                        }
+                        size_ = static_cast<std::size_t>(file_stat.st_size);
+
+                        if (size_ != 0) {
+                            void *address = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+                            if (address == MAP_FAILED) {
+                                int error = errno;
+                                ::close(fd);
+                                throw std::system_error(error, std::generic_category(), path);
+                            }
+                            data_ = static_cast<const std::uint8_t *>(address);
+                        }
+                        ::close(fd);
+
+                        advise(pattern);
+                    }
+
+                    mapped_file(const mapped_file &) = delete;
+                    mapped_file &operator=(const mapped_file &) = delete;
+
+                    mapped_file(mapped_file &&other) noexcept : 
+                        data_(std::exchange(other.data_, nullptr)), 
+                        size_(std::exchange(other.size_, 0)) {
+                    }
+
+                    mapped_file &operator=(mapped_file &&other) noexcept {
+                        if (this != &other) {
+                            unmap();
+                            data_ = std::exchange(other.data_, nullptr);
+                            size_ = std::exchange(other.size_, 0);
+                        }
+                        return *this;
+                    }
+
+                    ~mapped_file() {
+                        unmap();
+                    }
+
+                    /// @brief Change the access pattern of the whole mapping, e.g. to random
+                    ///     before indexed lookups. The advice is a hint, failures are ignored.
+                    void advise(access_pattern pattern) const noexcept {
+                        if (data_ == nullptr) {
+                            return;
+                        }
+
+                        int advice = MADV_NORMAL;
+                        if (pattern == access_pattern::sequential) {
+                            advice = MADV_SEQUENTIAL;
+                        } else if (pattern == access_pattern::random) {
+                            advice = MADV_RANDOM;
+                        }
+                        ::madvise(const_cast<std::uint8_t *>(data_), size_, advice);
+                    }
+
+                    const std::uint8_t *data() const noexcept {
+                        return data_;
+                    }
+
+                    std::size_t size() const noexcept {
+                        return size_;
+                    }
+
+                    const std::uint8_t *begin() const noexcept {
+                        return data_;
+                    }
+
+                    const std::uint8_t *end() const noexcept {
+                        return data_ + size_;
+                    }
+
+                private:
+                    void unmap() noexcept {
+                        if (data_ != nullptr) {
+                            ::munmap(const_cast<std::uint8_t *>(data_), size_);
+                        }
+                    }
+
+                    const std::uint8_t *data_ = nullptr;
+                    std::size_t size_ = 0;
+                };
+            }    // namespace io
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_IO_MAPPED_FILE_HPP
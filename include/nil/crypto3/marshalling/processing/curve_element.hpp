@@ -44,21 +44,24 @@ namespace nil {
         namespace marshalling {
             namespace processing {
 
+                /// @brief Write a point that is already in affine form, as produced by
+                ///     to_affine(). Callers normalizing many points at once use it to
+                ///     avoid an inversion per point.
+                /// @pre The buffer is zeroed, the flag bits are ORed into the first unit.
                 template<std::size_t TSize, 
                          typename Endianness, 
                          typename G1GroupElement, 
                          typename TIter>
                 typename std::enable_if<algebra::is_g1_group_element<G1GroupElement>::value, 
                     void>::type
-                    curve_element_write_data(const G1GroupElement &point, 
+                    curve_element_write_affine_data(const G1GroupElement &point_affine, 
                                TIter &iter) {
 
                     using chunk_type = 
-                            typename TIter::value_type;
+                            typename std::iterator_traits<TIter>::value_type;
 
                     constexpr static const chunk_type I_bit = 0x40;
 
-                    G1GroupElement point_affine = point.to_affine();
                     chunk_type m_unit = 
                         detail::evaluate_m_unit<chunk_type>(point_affine, true);
                     // TODO: check possibilities for TA
@@ -79,23 +82,22 @@ namespace nil {
                          typename TIter>
                 typename std::enable_if<algebra::is_g2_group_element<G2GroupElement>::value, 
                     void>::type
-                    curve_element_write_data(const G2GroupElement &point, 
+                    curve_element_write_affine_data(const G2GroupElement &point_affine, 
                                TIter &iter) {
 
                     using chunk_type = 
-                            typename TIter::value_type;
+                            typename std::iterator_traits<TIter>::value_type;
 
                     constexpr static const std::size_t sizeof_field_element = 
                         TSize/(G2GroupElement::underlying_field_type::arity);
                     constexpr static const std::size_t units_bits = 8;
-                    constexpr static const std::size_t chunk_bits = sizeof(typename TIter::value_type) * units_bits;
+                    constexpr static const std::size_t chunk_bits = sizeof(typename std::iterator_traits<TIter>::value_type) * units_bits;
                     constexpr static const std::size_t sizeof_field_element_chunks_count = 
                         (sizeof_field_element / chunk_bits) + 
                         ((sizeof_field_element % chunk_bits)?1:0);
 
                     constexpr static const chunk_type I_bit = 0x40;
 
-                    G2GroupElement point_affine = point.to_affine();
                     chunk_type m_unit = 
                         detail::evaluate_m_unit<chunk_type>(point_affine, true);
                     // TODO: check possibilities for TA
@@ -118,6 +120,21 @@ namespace nil {
                     (*iter) |= m_unit;
                 }
 
+                /// @brief Write a point given in any coordinates. Same as
+                ///     curve_element_write_affine_data after converting the point to affine form.
+                template<std::size_t TSize, 
+                         typename Endianness, 
+                         typename GroupElement, 
+                         typename TIter>
+                typename std::enable_if<algebra::is_g1_group_element<GroupElement>::value || 
+                                        algebra::is_g2_group_element<GroupElement>::value, 
+                    void>::type
+                    curve_element_write_data(const GroupElement &point, 
+                               TIter &iter) {
+
+                    curve_element_write_affine_data<TSize, Endianness>(point.to_affine(), iter);
+                }
+
                 template<std::size_t TSize,
                          typename Endianness, 
                          typename G1GroupElement, 
@@ -127,7 +144,7 @@ namespace nil {
                         curve_element_read_data(TIter &iter) {
 
                         using chunk_type = 
-                            typename TIter::value_type;
+                            typename std::iterator_traits<TIter>::value_type;
 
                         const chunk_type m_unit = *iter & 0xE0;
                         BOOST_ASSERT(m_unit != 0x20 && m_unit != 0x60 && m_unit != 0xE0);
@@ -184,7 +201,7 @@ namespace nil {
                             curve_element_read_data(TIter &iter) {
 
                             using chunk_type = 
-                                typename TIter::value_type;
+                                typename std::iterator_traits<TIter>::value_type;
 
                             const chunk_type m_unit = *iter & 0xE0;
                             BOOST_ASSERT(m_unit != 0x20 && m_unit != 0x60 && m_unit != 0xE0);
@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_MARSHALLING_PROCESSING_INTERGRAL_HPP
 #define CRYPTO3_MARSHALLING_PROCESSING_INTERGRAL_HPP
 
+#include <algorithm>
 #include <iterator>
 #include <cstddef>
 #include <cstdint>
@@ -78,9 +79,8 @@ namespace nil {
                         ((nil::crypto3::multiprecision::msb(value) + 1)/chunk_bits + 
                             (((nil::crypto3::multiprecision::msb(value) + 1) % chunk_bits)?1:0));
 
-                    std::fill(iter, iter + begin_index, 0);
-
-                    export_bits(value, iter + begin_index, chunk_bits, true);
+                    // no iterator arithmetic, so output iterators are accepted as well
+                    export_bits(value, std::fill_n(iter, begin_index, 0), chunk_bits, true);
                 }
 
                 /// @brief Read part of integral value from the input area using big
@@ -165,11 +165,8 @@ namespace nil {
                         ((nil::crypto3::multiprecision::msb(value) + 1)/chunk_bits + 
                             (((nil::crypto3::multiprecision::msb(value) + 1) % chunk_bits)?1:0));
 
-                    if (end_index < chunks_count){
-                        std::fill(iter + end_index, iter + chunks_count, 0x00);
-                    }
-                    
-                    export_bits(value, iter, chunk_bits, false);
+                    // the value takes the first chunks, the padding follows it
+                    std::fill_n(export_bits(value, iter, chunk_bits, false), end_index, 0x00);
                 }
 
                 /// @brief Read integral value from the input area using little
@@ -0,0 +1,570 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_COMPACT_FIELD_ELEMENT_HPP
+#define CRYPTO3_MARSHALLING_COMPACT_FIELD_ELEMENT_HPP
+
+#include <ratio>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <iterator>
+
+#include <boost/assert.hpp>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/tag.hpp>
+#include <nil/marshalling/types/detail/adapt_basic_field.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/marshalling/types/algebra/field_element.hpp>
+#include <nil/crypto3/marshalling/types/detail/parallel_ranges.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /// @brief Variable-width encoding of a vector of field elements.
+                /// @details Every base field coordinate is written as a one byte length
+                ///     tag followed by that many bytes of its value, most significant byte
+                ///     first for big endian and last for little endian. Zero has an empty
+                ///     payload. The encoding is canonical: the most significant payload
+                ///     byte is never zero and the value is always below the modulus.
+                template<typename TTypeBase, 
+                         typename FieldType, 
+                         typename = typename std::enable_if<
+                            algebra::is_field<FieldType>::value, 
+                            bool>::type,
+                         typename... TOptions>
+                using compact_field_element_vector = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // elements count
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >,
+                            // tagged payload
+                            nil::marshalling::types::array_list<
+                                TTypeBase,
+                                std::uint8_t,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        TTypeBase, 
+                                        std::size_t
+                                    >
+                                > 
+                            >
+                        >
+                    >;
+
+                /// @brief compact_field_element_vector with an offset index.
+                /// @details The index holds the payload offset of every block_size-th
+                ///     element, a sampled prefix sum of the element lengths. A reader
+                ///     can start decoding at any block boundary, so blocks are decoded
+                ///     in parallel and element i is reached by decoding at most
+                ///     block_size - 1 elements before it.
+                template<typename TTypeBase, 
+                         typename FieldType, 
+                         typename = typename std::enable_if<
+                            algebra::is_field<FieldType>::value, 
+                            bool>::type,
+                         typename... TOptions>
+                using indexed_compact_field_element_vector = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // elements count
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >,
+                            // block_size
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >,
+                            // block offsets
+                            nil::marshalling::types::array_list<
+                                TTypeBase,
+                                nil::marshalling::types::integral<
+                                    TTypeBase, 
+                                    std::size_t
+                                >,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        TTypeBase, 
+                                        std::size_t
+                                    >
+                                > 
+                            >,
+                            // tagged payload
+                            nil::marshalling::types::array_list<
+                                TTypeBase,
+                                std::uint8_t,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        TTypeBase, 
+                                        std::size_t
+                                    >
+                                > 
+                            >
+                        >
+                    >;
+
+                namespace detail {
+                    template<typename FieldType>
+                    constexpr std::size_t compact_field_element_max_bytes() {
+                        return FieldType::modulus_bits / 8 + 
+                            ((FieldType::modulus_bits % 8)?1:0);
+                    }
+
+                    template<typename FieldType, 
+                             typename Endianness>
+                    void write_compact_field_element_data(
+                        const field_coordinate_type<FieldType> &value, 
+                        std::vector<std::uint8_t> &out){
+
+                        constexpr static const bool big_endian = 
+                            std::is_same<typename nil::marshalling::field_type<Endianness>::endian_type, 
+                                nil::marshalling::endian::big_endian>::value;
+
+                        if (value.is_zero()) {
+                            out.push_back(0);
+                            return;
+                        }
+
+                        const std::size_t bytes_count = multiprecision::msb(value) / 8 + 1;
+                        out.push_back(static_cast<std::uint8_t>(bytes_count));
+                        multiprecision::export_bits(value, std::back_inserter(out), 8, big_endian);
+                    }
+
+                    /// @brief Decode one coordinate from the tagged payload.
+                    /// @details The payload is copied into a zero-filled staging buffer of
+                    ///     the full element width, so the value is always imported with a
+                    ///     single fixed-size call, regardless of its length.
+                    template<typename FieldType, 
+                             typename Endianness>
+                    field_coordinate_type<FieldType> 
+                        read_compact_field_element_data(
+                            const std::vector<std::uint8_t> &in, 
+                            std::size_t &pos, 
+                            nil::marshalling::status_type &status){
+
+                        using coordinate_type = field_coordinate_type<FieldType>;
+
+                        constexpr static const bool big_endian = 
+                            std::is_same<typename nil::marshalling::field_type<Endianness>::endian_type, 
+                                nil::marshalling::endian::big_endian>::value;
+                        constexpr static const std::size_t max_bytes = 
+                            compact_field_element_max_bytes<FieldType>();
+
+                        if (pos >= in.size()) {
+                            status = nil::marshalling::status_type::not_enough_data;
+                            return coordinate_type(0);
+                        }
+
+                        const std::size_t bytes_count = in[pos++];
+                        if (bytes_count > max_bytes) {
+                            status = nil::marshalling::status_type::invalid_msg_data;
+                            return coordinate_type(0);
+                        }
+                        if (in.size() - pos < bytes_count) {
+                            status = nil::marshalling::status_type::not_enough_data;
+                            return coordinate_type(0);
+                        }
+
+                        std::array<std::uint8_t, max_bytes> staging = {};
+                        const std::size_t staging_offset = big_endian ? max_bytes - bytes_count : 0;
+                        std::copy(in.begin() + pos, 
+                                  in.begin() + pos + bytes_count, 
+                                  staging.begin() + staging_offset);
+                        // the most significant payload byte sits next to the padding
+                        const std::uint8_t leading_byte = 
+                            staging[big_endian ? staging_offset : 
+                                (bytes_count ? bytes_count - 1 : 0)];
+                        pos += bytes_count;
+
+                        coordinate_type value;
+                        multiprecision::import_bits(value, staging.begin(), staging.end(), 8, big_endian);
+
+                        const bool non_canonical = 
+                            (bytes_count != 0) & (leading_byte == 0);
+                        const bool out_of_range = !(value < FieldType::modulus);
+                        if (non_canonical | out_of_range) {
+                            status = nil::marshalling::status_type::invalid_msg_data;
+                            return coordinate_type(0);
+                        }
+
+                        return value;
+                    }
+
+                    /// @brief Decode the elements [begin, end) starting at payload offset pos.
+                    template<typename FieldType, 
+                             typename Endianness>
+                    void read_compact_field_element_range(
+                        const std::vector<std::uint8_t> &in, 
+                        std::size_t &pos, 
+                        std::size_t begin, 
+                        std::size_t end, 
+                        typename FieldType::value_type *out, 
+                        nil::marshalling::status_type &status){
+
+                        std::array<field_coordinate_type<FieldType>, FieldType::arity> field_elem_data;
+                        for (std::size_t i = begin; i < end; i++) {
+                            for (std::size_t j = 0; j < FieldType::arity; j++) {
+                                field_elem_data[j] = 
+                                    read_compact_field_element_data<FieldType, Endianness>(
+                                        in, pos, status);
+                                if (status != nil::marshalling::status_type::success) {
+                                    return;
+                                }
+                            }
+                            out[i - begin] = construct_field_element<FieldType>(field_elem_data.begin());
+                        }
+                    }
+
+                    /// @brief Check that the block offsets start at zero, do not decrease
+                    ///     and stay within the payload.
+                    template<typename IndexedVector>
+                    nil::marshalling::status_type check_compact_field_element_index(
+                        const IndexedVector &field_elem_vector){
+
+                        const std::size_t size = std::get<0>(field_elem_vector.value()).value();
+                        const std::size_t block_size = std::get<1>(field_elem_vector.value()).value();
+                        const auto &offsets = std::get<2>(field_elem_vector.value()).value();
+                        const std::size_t payload_size = std::get<3>(field_elem_vector.value()).value().size();
+
+                        if (block_size == 0 || 
+                            offsets.size() != size / block_size + ((size % block_size)?1:0)) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+                        std::size_t previous = 0;
+                        for (const auto &offset : offsets) {
+                            if (offset.value() < previous || offset.value() > payload_size) {
+                                return nil::marshalling::status_type::invalid_msg_data;
+                            }
+                            previous = offset.value();
+                        }
+                        if (!offsets.empty() && offsets.front().value() != 0) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+                        return nil::marshalling::status_type::success;
+                    }
+                }    // namespace detail
+
+                template<typename FieldType, 
+                         typename Endianness>
+                compact_field_element_vector<
+                    nil::marshalling::field_type<
+                        Endianness>,
+                    FieldType>
+                    fill_compact_field_element_vector(
+                        const std::vector<typename FieldType::value_type> &field_elem_vector){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using size_type = 
+                        nil::marshalling::types::integral<
+                            TTypeBase, 
+                            std::size_t
+                        >;
+
+                    compact_field_element_vector<TTypeBase, FieldType> result;
+
+                    std::get<0>(result.value()) = size_type(field_elem_vector.size());
+
+                    std::vector<std::uint8_t> &payload = std::get<1>(result.value()).value();
+                    // small values are the common case: reserve a couple of bytes per coordinate
+                    payload.reserve(field_elem_vector.size() * FieldType::arity * 3);
+                    for (const typename FieldType::value_type &field_elem : field_elem_vector) {
+                        std::array<field_coordinate_type<FieldType>, FieldType::arity> field_elem_data = 
+                            detail::obtain_field_data<FieldType>(field_elem);
+                        for (const field_coordinate_type<FieldType> &coordinate : field_elem_data) {
+                            detail::write_compact_field_element_data<FieldType, Endianness>(
+                                coordinate, payload);
+                        }
+                    }
+
+                    return result;
+                }
+
+                /// @param[out] status Set to invalid_msg_data on a non-canonical or
+                ///     out of range coordinate, and to not_enough_data on a truncated
+                ///     payload.
+                template<typename FieldType, 
+                         typename Endianness>
+                std::vector<typename FieldType::value_type>
+                    construct_compact_field_element_vector(
+                        const compact_field_element_vector<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            FieldType> &field_elem_vector, 
+                        nil::marshalling::status_type &status){
+
+                    const std::size_t size = std::get<0>(field_elem_vector.value()).value();
+                    const std::vector<std::uint8_t> &payload = std::get<1>(field_elem_vector.value()).value();
+
+                    status = nil::marshalling::status_type::success;
+
+                    std::vector<typename FieldType::value_type> result;
+                    // every coordinate takes at least its tag byte
+                    if (payload.size() / FieldType::arity < size) {
+                        status = nil::marshalling::status_type::not_enough_data;
+                        return result;
+                    }
+                    result.resize(size);
+
+                    std::size_t pos = 0;
+                    detail::read_compact_field_element_range<FieldType, Endianness>(
+                        payload, pos, 0, size, result.data(), status);
+                    if (status != nil::marshalling::status_type::success) {
+                        return std::vector<typename FieldType::value_type>();
+                    }
+
+                    if (pos != payload.size()) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return std::vector<typename FieldType::value_type>();
+                    }
+
+                    return result;
+                }
+
+                template<typename FieldType, 
+                         typename Endianness>
+                std::size_t compact_field_element_vector_serialized_size(
+                    const std::vector<typename FieldType::value_type> &field_elem_vector){
+
+                    constexpr static const std::size_t size_length = 
+                        nil::marshalling::types::integral<
+                            nil::marshalling::field_type<
+                                Endianness>, 
+                            std::size_t>::max_length();
+
+                    std::size_t payload_size = 0;
+                    for (const typename FieldType::value_type &field_elem : field_elem_vector) {
+                        std::array<field_coordinate_type<FieldType>, FieldType::arity> field_elem_data = 
+                            detail::obtain_field_data<FieldType>(field_elem);
+                        for (const field_coordinate_type<FieldType> &coordinate : field_elem_data) {
+                            payload_size += 1 + (coordinate.is_zero() ? 0 : 
+                                multiprecision::msb(coordinate) / 8 + 1);
+                        }
+                    }
+
+                    return 2 * size_length + payload_size;
+                }
+
+                /// @param[in] block_size Number of elements between two indexed offsets.
+                template<typename FieldType, 
+                         typename Endianness>
+                indexed_compact_field_element_vector<
+                    nil::marshalling::field_type<
+                        Endianness>,
+                    FieldType>
+                    fill_indexed_compact_field_element_vector(
+                        const std::vector<typename FieldType::value_type> &field_elem_vector, 
+                        std::size_t block_size = 64){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using size_type = 
+                        nil::marshalling::types::integral<
+                            TTypeBase, 
+                            std::size_t
+                        >;
+
+                    BOOST_ASSERT(block_size != 0);
+
+                    indexed_compact_field_element_vector<TTypeBase, FieldType> result;
+
+                    std::get<0>(result.value()) = size_type(field_elem_vector.size());
+                    std::get<1>(result.value()) = size_type(block_size);
+
+                    std::vector<size_type> &offsets = std::get<2>(result.value()).value();
+                    std::vector<std::uint8_t> &payload = std::get<3>(result.value()).value();
+                    offsets.reserve(field_elem_vector.size() / block_size + 1);
+                    payload.reserve(field_elem_vector.size() * FieldType::arity * 3);
+                    for (std::size_t i = 0; i < field_elem_vector.size(); i++) {
+                        if (i % block_size == 0) {
+                            offsets.emplace_back(payload.size());
+                        }
+                        std::array<field_coordinate_type<FieldType>, FieldType::arity> field_elem_data = 
+                            detail::obtain_field_data<FieldType>(field_elem_vector[i]);
+                        for (const field_coordinate_type<FieldType> &coordinate : field_elem_data) {
+                            detail::write_compact_field_element_data<FieldType, Endianness>(
+                                coordinate, payload);
+                        }
+                    }
+
+                    return result;
+                }
+
+                /// @brief Decode the blocks concurrently, each from its indexed offset.
+                /// @param[out] status Set to invalid_msg_data on a malformed index, a
+                ///     block that does not end where the next one starts, or a
+                ///     non-canonical or out of range coordinate, and to not_enough_data
+                ///     on a truncated payload.
+                /// @param[in] threads_count Number of ranges of blocks, 0 for one per
+                ///     hardware thread.
+                template<typename FieldType, 
+                         typename Endianness>
+                std::vector<typename FieldType::value_type>
+                    construct_indexed_compact_field_element_vector(
+                        const indexed_compact_field_element_vector<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            FieldType> &field_elem_vector, 
+                        nil::marshalling::status_type &status, 
+                        std::size_t threads_count = 0){
+
+                    status = detail::check_compact_field_element_index(field_elem_vector);
+                    if (status != nil::marshalling::status_type::success) {
+                        return std::vector<typename FieldType::value_type>();
+                    }
+
+                    const std::size_t size = std::get<0>(field_elem_vector.value()).value();
+                    const std::size_t block_size = std::get<1>(field_elem_vector.value()).value();
+                    const auto &offsets = std::get<2>(field_elem_vector.value()).value();
+                    const std::vector<std::uint8_t> &payload = std::get<3>(field_elem_vector.value()).value();
+
+                    std::vector<typename FieldType::value_type> result;
+                    // every coordinate takes at least its tag byte
+                    if (payload.size() / FieldType::arity < size) {
+                        status = nil::marshalling::status_type::not_enough_data;
+                        return result;
+                    }
+                    result.resize(size);
+
+                    std::vector<nil::marshalling::status_type> blocks_status(
+                        offsets.size(), nil::marshalling::status_type::success);
+                    detail::parallel_for_ranges(offsets.size(), threads_count, 
+                        [&](std::size_t blocks_begin, std::size_t blocks_end) {
+                            for (std::size_t block = blocks_begin; block < blocks_end; block++) {
+                                const std::size_t begin = block * block_size;
+                                const std::size_t end = std::min(begin + block_size, size);
+                                const std::size_t block_end = (block + 1 < offsets.size()) ? 
+                                    offsets[block + 1].value() : payload.size();
+
+                                std::size_t pos = offsets[block].value();
+                                detail::read_compact_field_element_range<FieldType, Endianness>(
+                                    payload, pos, begin, end, result.data() + begin, blocks_status[block]);
+                                if (blocks_status[block] == nil::marshalling::status_type::success && 
+                                    pos != block_end) {
+                                    blocks_status[block] = nil::marshalling::status_type::invalid_msg_data;
+                                }
+                            }
+                        });
+
+                    for (nil::marshalling::status_type block_status : blocks_status) {
+                        if (block_status != nil::marshalling::status_type::success) {
+                            status = block_status;
+                            return std::vector<typename FieldType::value_type>();
+                        }
+                    }
+
+                    return result;
+                }
+
+                /// @brief Decode only element i, starting from the offset of its block.
+                /// @param[out] status Same as construct_indexed_compact_field_element_vector,
+                ///     and invalid_msg_data if i is out of range.
+                template<typename FieldType, 
+                         typename Endianness>
+                typename FieldType::value_type
+                    read_indexed_compact_field_element(
+                        const indexed_compact_field_element_vector<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            FieldType> &field_elem_vector, 
+                        std::size_t i, 
+                        nil::marshalling::status_type &status){
+
+                    const std::size_t size = std::get<0>(field_elem_vector.value()).value();
+                    const std::size_t block_size = std::get<1>(field_elem_vector.value()).value();
+                    const auto &offsets = std::get<2>(field_elem_vector.value()).value();
+                    const std::vector<std::uint8_t> &payload = std::get<3>(field_elem_vector.value()).value();
+
+                    status = nil::marshalling::status_type::success;
+                    if (block_size == 0 || i >= size || i / block_size >= offsets.size()) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return typename FieldType::value_type();
+                    }
+
+                    std::size_t pos = offsets[i / block_size].value();
+                    if (pos > payload.size()) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return typename FieldType::value_type();
+                    }
+
+                    std::vector<typename FieldType::value_type> block(i % block_size + 1);
+                    detail::read_compact_field_element_range<FieldType, Endianness>(
+                        payload, pos, 0, block.size(), block.data(), status);
+                    if (status != nil::marshalling::status_type::success) {
+                        return typename FieldType::value_type();
+                    }
+
+                    return block.back();
+                }
+
+                template<typename FieldType, 
+                         typename Endianness>
+                std::size_t indexed_compact_field_element_vector_serialized_size(
+                    const std::vector<typename FieldType::value_type> &field_elem_vector, 
+                    std::size_t block_size = 64){
+
+                    constexpr static const std::size_t size_length = 
+                        nil::marshalling::types::integral<
+                            nil::marshalling::field_type<
+                                Endianness>, 
+                            std::size_t>::max_length();
+
+                    const std::size_t blocks_count = field_elem_vector.size() / block_size + 
+                        ((field_elem_vector.size() % block_size)?1:0);
+
+                    return compact_field_element_vector_serialized_size<FieldType, Endianness>(
+                            field_elem_vector) + 
+                        (2 + blocks_count) * size_length;
+                }
+
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_COMPACT_FIELD_ELEMENT_HPP
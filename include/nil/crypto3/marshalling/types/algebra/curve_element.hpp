@@ -29,6 +29,8 @@
 #include <ratio>
 #include <limits>
 #include <type_traits>
+#include <algorithm>
+#include <vector>
 
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/options.hpp>
@@ -37,7 +39,11 @@
 #include <nil/marshalling/types/tag.hpp>
 #include <nil/marshalling/types/detail/adapt_basic_field.hpp>
 
+#include <nil/crypto3/marshalling/processing/curve_element.hpp>
 #include <nil/crypto3/marshalling/types/algebra/curve_element/basic_type.hpp>
+#include <nil/crypto3/marshalling/types/integral/fixed_precision_backend.hpp>
+#include <nil/crypto3/marshalling/types/detail/parallel_ranges.hpp>
+#include <nil/crypto3/marshalling/types/detail/staging.hpp>
 namespace nil {
     namespace crypto3 {
         namespace marshalling {
@@ -264,6 +270,11 @@ namespace nil {
                         !parsed_options_type::has_versions_range,
                         "nil::marshalling::option::exists_between_versions (or similar) option is not applicable to "
                         "crypto3::curve_element type");
+                    static_assert(
+                        std::is_same<
+                            field_coordinate_type<typename curve_group_type::underlying_field_type>,
+                            typename curve_group_type::underlying_field_type::modulus_type>::value,
+                        "crypto3::curve_element coordinates must use a fixed precision backend");
                 };
 
                 /// @brief Equality comparison operator.
@@ -388,50 +399,45 @@ namespace nil {
                     return field;
                 }
 
+                /// @brief Fill the curve_element vector.
+                /// @details CurveElementVector may replace the element storage through
+                ///     nil::marshalling::option::custom_storage_type, e.g. with a
+                ///     std::pmr::vector, which is then constructed with allocator.
                 template<typename CurveGroupType, 
-                         typename Endianness>
-                nil::marshalling::types::array_list<
-                    nil::marshalling::field_type<
-                            Endianness>,
-                    curve_element<
-                        nil::marshalling::field_type<
-                            Endianness>,
-                        CurveGroupType>,
-                    nil::marshalling::option::sequence_size_field_prefix<
-                        nil::marshalling::types::integral<
-                            nil::marshalling::field_type<
-                            Endianness>, 
-                            std::size_t
-                        >
-                    > 
-                >
-                    fill_curve_element_vector(std::vector<typename CurveGroupType::value_type> curve_elem_vector){
-
-                    using TTypeBase = nil::marshalling::field_type<
-                                Endianness>;
+                         typename Endianness, 
+                         typename CurveElementVector = 
+                            nil::marshalling::types::array_list<
+                                nil::marshalling::field_type<
+                                        Endianness>,
+                                curve_element<
+                                    nil::marshalling::field_type<
+                                        Endianness>,
+                                    CurveGroupType>,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        nil::marshalling::field_type<
+                                        Endianness>, 
+                                        std::size_t
+                                    >
+                                > 
+                            >>
+                CurveElementVector
+                    fill_curve_element_vector(const std::vector<typename CurveGroupType::value_type> &curve_elem_vector, 
+                                              const typename CurveElementVector::value_type::allocator_type &allocator = 
+                                                  typename CurveElementVector::value_type::allocator_type()){
 
                     using curve_element_type = 
                         curve_element<
-                            TTypeBase,
+                            nil::marshalling::field_type<
+                                Endianness>,
                             CurveGroupType
                         >;
 
-                    using curve_element_vector_type = 
-                        nil::marshalling::types::array_list<
-                            TTypeBase,
-                            curve_element_type,
-                            nil::marshalling::option::sequence_size_field_prefix<
-                                nil::marshalling::types::integral<
-                                    nil::marshalling::field_type<
-                                    Endianness>, 
-                                    std::size_t
-                                >
-                            > 
-                        >;
-
-                    curve_element_vector_type result;
+                    CurveElementVector result(
+                        typename CurveElementVector::value_type(allocator));
 
-                    std::vector<curve_element_type> &val = result.value();
+                    auto &val = result.value();
+                    val.reserve(curve_elem_vector.size());
                     for (std::size_t i=0; 
                          i<curve_elem_vector.size();
                          i++){
@@ -441,11 +447,15 @@ namespace nil {
                     return result;
                 }
 
+                /// @brief Construct the native elements of a curve_element vector filled by
+                ///     fill_curve_element_vector, into a Result constructed with allocator.
                 template<typename CurveGroupType, 
-                         typename Endianness>
-                std::vector<typename CurveGroupType::value_type>
+                         typename Endianness, 
+                         typename Result = std::vector<typename CurveGroupType::value_type>, 
+                         typename... TOptions>
+                Result
                     construct_curve_element_vector(
-                        nil::marshalling::types::array_list<
+                        const nil::marshalling::types::array_list<
                             nil::marshalling::field_type<
                                 Endianness>,
                             curve_element<
@@ -453,22 +463,15 @@ namespace nil {
                                     Endianness>,
                                 CurveGroupType
                             >,
-                            nil::marshalling::option::sequence_size_field_prefix<
-                                nil::marshalling::types::integral<
-                                    nil::marshalling::field_type<
-                                    Endianness>, 
-                                    std::size_t
-                                >
-                            > 
-                        > curve_elem_vector){
-
-                    std::vector<typename CurveGroupType::value_type> result;
-                    std::vector<curve_element<
-                            nil::marshalling::field_type<
-                                Endianness>,
-                            CurveGroupType
-                        >> &values = curve_elem_vector.value();
+                            TOptions...
+                        > &curve_elem_vector, 
+                        const typename Result::allocator_type &allocator = 
+                            typename Result::allocator_type()){
+
+                    Result result(allocator);
+                    const auto &values = curve_elem_vector.value();
                     std::size_t size = values.size();
+                    result.reserve(size);
 
                     for (std::size_t i=0; 
                          i<size;
@@ -478,6 +481,291 @@ namespace nil {
                     }
                     return result;
                 }
+                template<typename CurveGroupType, 
+                         typename Endianness>
+                constexpr std::size_t curve_element_serialized_size() {
+                    return curve_element<
+                        nil::marshalling::field_type<
+                            Endianness>,
+                        CurveGroupType>::max_length();
+                }
+
+                template<typename CurveGroupType, 
+                         typename Endianness>
+                std::size_t curve_element_vector_serialized_size(
+                    const std::vector<typename CurveGroupType::value_type> &curve_elem_vector) {
+                    return nil::marshalling::types::integral<
+                            nil::marshalling::field_type<
+                                Endianness>, 
+                            std::size_t>::max_length() + 
+                        curve_elem_vector.size() * 
+                            curve_element_serialized_size<CurveGroupType, Endianness>();
+                }
+
+                /// @brief Write the point as curve_element does, without constructing it.
+                /// @pre At least
+                ///     curve_element_serialized_size() units can be written, unless the
+                ///     iterator is an output iterator such as std::back_inserter.
+                /// @post The iterator is advanced.
+                template<typename CurveGroupType, 
+                         typename Endianness, 
+                         typename TIter>
+                void write_curve_element_data(const typename CurveGroupType::value_type &curve_elem, 
+                                              TIter &iter) {
+                    using curve_element_type = 
+                        curve_element<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            CurveGroupType>;
+
+                    detail::write_staged<curve_element_type::max_length()>(iter, 
+                        [&curve_elem](auto &block_iter) {
+                            // curve_element_write_data ORs the flag bits into the first unit
+                            std::fill_n(block_iter, curve_element_type::max_length(), 0x00);
+                            processing::curve_element_write_data<
+                                curve_element_type::bit_length(), 
+                                typename nil::marshalling::field_type<
+                                    Endianness>::endian_type>(curve_elem, block_iter);
+                        });
+                }
+
+                /// @brief Write the points as the array_list produced by
+                ///     fill_curve_element_vector does.
+                /// @post The iterator is advanced.
+                template<typename CurveGroupType, 
+                         typename Endianness, 
+                         typename TIter>
+                void write_curve_element_vector_data(
+                    const std::vector<typename CurveGroupType::value_type> &curve_elem_vector, 
+                    TIter &iter) {
+
+                    nil::marshalling::types::integral<
+                        nil::marshalling::field_type<
+                            Endianness>, 
+                        std::size_t> size(curve_elem_vector.size());
+                    size.write(iter, size.length());
+
+                    for (const typename CurveGroupType::value_type &curve_elem : curve_elem_vector) {
+                        write_curve_element_data<CurveGroupType, Endianness>(curve_elem, iter);
+                    }
+                }
+
+                namespace detail {
+                    /// @brief Convert points to affine form with a single field inversion.
+                    /// @details The Z coordinates are inverted together with Montgomery's
+                    ///     trick. Group value types do not expose their coordinate system,
+                    ///     so it is told from the first finite point for which projective
+                    ///     and Jacobian normalization give different results, such as any
+                    ///     point with Z != 1, by matching it against to_affine(). Points for
+                    ///     which both agree do not decide anything; if no point decides,
+                    ///     as for already normalized points, the common result is used.
+                    ///     Only if the deciding point matches neither is every point
+                    ///     converted with to_affine().
+                    template<typename GroupValueType>
+                    void batch_to_affine(const GroupValueType *points, 
+                                         std::size_t size, 
+                                         GroupValueType *out) {
+                        using field_value_type = 
+                            typename GroupValueType::underlying_field_type::value_type;
+
+                        std::vector<field_value_type> z_inversed;
+                        z_inversed.reserve(size);
+                        field_value_type accumulator = field_value_type::one();
+                        for (std::size_t i = 0; i < size; i++) {
+                            z_inversed.push_back(accumulator);
+                            if (!points[i].is_zero()) {
+                                accumulator = accumulator * points[i].Z;
+                            }
+                        }
+                        field_value_type accumulator_inversed = accumulator.inversed();
+                        for (std::size_t i = size; i-- > 0;) {
+                            if (!points[i].is_zero()) {
+                                z_inversed[i] = z_inversed[i] * accumulator_inversed;
+                                accumulator_inversed = accumulator_inversed * points[i].Z;
+                            }
+                        }
+
+                        enum class coordinates { undecided, projective, jacobian, unknown };
+                        coordinates system = coordinates::undecided;
+                        for (std::size_t i = 0; i < size; i++) {
+                            if (points[i].is_zero()) {
+                                continue;
+                            }
+                            const field_value_type z_inversed_squared = z_inversed[i].squared();
+                            const field_value_type projective_X = points[i].X * z_inversed[i];
+                            const field_value_type projective_Y = points[i].Y * z_inversed[i];
+                            const field_value_type jacobian_X = points[i].X * z_inversed_squared;
+                            const field_value_type jacobian_Y = 
+                                points[i].Y * z_inversed_squared * z_inversed[i];
+                            if (projective_X == jacobian_X && projective_Y == jacobian_Y) {
+                                continue;
+                            }
+
+                            const GroupValueType reference = points[i].to_affine();
+                            if (reference.X == projective_X && reference.Y == projective_Y) {
+                                system = coordinates::projective;
+                            } else if (reference.X == jacobian_X && reference.Y == jacobian_Y) {
+                                system = coordinates::jacobian;
+                            } else {
+                                system = coordinates::unknown;
+                            }
+                            break;
+                        }
+
+                        for (std::size_t i = 0; i < size; i++) {
+                            if (points[i].is_zero() || system == coordinates::unknown) {
+                                out[i] = points[i].to_affine();
+                            } else if (system != coordinates::jacobian) {
+                                // projective, or undecided where both formulas agree
+                                out[i] = GroupValueType(points[i].X * z_inversed[i], 
+                                                        points[i].Y * z_inversed[i], 
+                                                        field_value_type::one());
+                            } else {
+                                const field_value_type z_inversed_squared = z_inversed[i].squared();
+                                out[i] = GroupValueType(points[i].X * z_inversed_squared, 
+                                                        points[i].Y * z_inversed_squared * z_inversed[i], 
+                                                        field_value_type::one());
+                            }
+                        }
+                    }
+                }    // namespace detail
+
+                /// @brief Same as write_curve_element_vector_data, with the elements split
+                ///     into ranges that are normalized and written concurrently.
+                /// @details Element i is always written at the prefix plus i times the
+                ///     element length, so every range goes straight to its place in the
+                ///     output. Each range converts its points to affine form with one
+                ///     batched inversion.
+                /// @param[in] threads_count Number of ranges, 0 for one per hardware thread.
+                /// @pre The iterator is random access and at least
+                ///     curve_element_vector_serialized_size() units can be written.
+                /// @post The iterator is advanced.
+                template <typename CurveGroupType, 
+                          typename Endianness, 
+                          typename TIter>
+                void write_curve_element_vector_data_parallel(
+                    const std::vector<typename CurveGroupType::value_type> &curve_elem_vector, 
+                    TIter &iter, 
+                    std::size_t threads_count = 0) {
+
+                    using curve_element_type = 
+                        curve_element<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            CurveGroupType>;
+
+                    nil::marshalling::types::integral<
+                        nil::marshalling::field_type<
+                            Endianness>, 
+                        std::size_t> size(curve_elem_vector.size());
+                    size.write(iter, size.length());
+
+                    detail::parallel_for_ranges(curve_elem_vector.size(), threads_count, 
+                        [&curve_elem_vector, iter](std::size_t begin, std::size_t end) {
+                            std::vector<typename CurveGroupType::value_type> affine(end - begin);
+                            detail::batch_to_affine(curve_elem_vector.data() + begin, end - begin, 
+                                                    affine.data());
+
+                            TIter range_iter = iter + begin * curve_element_type::max_length();
+                            std::fill_n(range_iter, (end - begin) * curve_element_type::max_length(), 0x00);
+                            for (const typename CurveGroupType::value_type &point : affine) {
+                                processing::curve_element_write_affine_data<
+                                    curve_element_type::bit_length(), 
+                                    typename nil::marshalling::field_type<
+                                        Endianness>::endian_type>(point, range_iter);
+                                range_iter += curve_element_type::max_length();
+                            }
+                        });
+
+                    iter += curve_elem_vector.size() * curve_element_type::max_length();
+                }
+
+                /// @brief Read an element written by write_curve_element_data
+                ///     without constructing the curve_element wrapper.
+                /// @param[in, out] iter Iterator to read the data, advanced on success.
+                /// @param[in, out] size Number of bytes available for reading, decreased on success.
+                /// @param[out] status Status of read operation.
+                template <typename CurveGroupType, 
+                          typename Endianness, 
+                          typename TIter>
+                typename CurveGroupType::value_type
+                    read_curve_element_data(TIter &iter, 
+                                            std::size_t &size, 
+                                            nil::marshalling::status_type &status) {
+                    using curve_element_type = 
+                        curve_element<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            CurveGroupType>;
+
+                    if (size < curve_element_type::max_length()) {
+                        status = nil::marshalling::status_type::not_enough_data;
+                        return typename CurveGroupType::value_type();
+                    }
+
+                    typename CurveGroupType::value_type result = 
+                        detail::read_staged<
+                            typename CurveGroupType::value_type, 
+                            curve_element_type::max_length()>(iter, 
+                            [](auto &block_iter) {
+                                return processing::curve_element_read_data<
+                                    curve_element_type::bit_length(), 
+                                    typename nil::marshalling::field_type<
+                                        Endianness>::endian_type, 
+                                    typename CurveGroupType::value_type>(block_iter);
+                            });
+                    size -= curve_element_type::max_length();
+                    status = nil::marshalling::status_type::success;
+                    return result;
+                }
+
+                /// @brief Read elements written by write_curve_element_vector_data.
+                /// @details The element count is validated against the available
+                ///     size before any storage is allocated. The elements are stored
+                ///     in a Result constructed with allocator.
+                template <typename CurveGroupType, 
+                          typename Endianness, 
+                          typename Result = std::vector<typename CurveGroupType::value_type>, 
+                          typename TIter>
+                Result
+                    read_curve_element_vector_data(TIter &iter, 
+                                                   std::size_t &size, 
+                                                   nil::marshalling::status_type &status, 
+                                                   const typename Result::allocator_type &allocator = 
+                                                       typename Result::allocator_type()) {
+                    using size_type = 
+                        nil::marshalling::types::integral<
+                            nil::marshalling::field_type<
+                                Endianness>, 
+                            std::size_t>;
+
+                    Result result(allocator);
+
+                    if (size < size_type::max_length()) {
+                        status = nil::marshalling::status_type::not_enough_data;
+                        return result;
+                    }
+                    size_type elements_count;
+                    status = elements_count.read(iter, size);
+                    size -= size_type::max_length();
+
+                    if (elements_count.value() > 
+                            size / curve_element_serialized_size<CurveGroupType, Endianness>()) {
+                        status = nil::marshalling::status_type::not_enough_data;
+                        return result;
+                    }
+
+                    result.reserve(elements_count.value());
+                    for (std::size_t i = 0; 
+                         i < elements_count.value() && 
+                            status == nil::marshalling::status_type::success; 
+                         i++) {
+                        result.emplace_back(
+                            read_curve_element_data<CurveGroupType, Endianness>(iter, size, status));
+                    }
+                    return result;
+                }
+
             }    // namespace types
         }        // namespace marshalling
     }        // namespace crypto3
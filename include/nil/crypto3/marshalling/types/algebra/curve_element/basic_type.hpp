@@ -31,6 +31,7 @@
 #include <nil/marshalling/status_type.hpp>
 
 #include <nil/crypto3/marshalling/processing/curve_element.hpp>
+#include <nil/crypto3/marshalling/types/detail/staging.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -108,8 +109,13 @@ namespace nil {
                             //     return nil::marshalling::status_type::not_enough_data;
                             // }
 
-                            read_no_status(iter);
-                            iter += max_length();
+                            value_ = read_staged<value_type, max_length()>(iter, 
+                                [](auto &block_iter) {
+                                    return crypto3::marshalling::
+                                        processing::curve_element_read_data<bit_length(), 
+                                            typename base_impl_type::endian_type, 
+                                            value_type>(block_iter);
+                                });
                             return nil::marshalling::status_type::success;
                         }
 
@@ -127,8 +133,10 @@ namespace nil {
                             //     return nil::marshalling::status_type::buffer_overflow;
                             // }
 
-                            write_no_status(iter);
-                            iter += max_length();
+                            write_staged<max_length()>(iter, 
+                                [this](auto &block_iter) {
+                                    write_no_status(block_iter);
+                                });
                             return nil::marshalling::status_type::success;
                         }
 
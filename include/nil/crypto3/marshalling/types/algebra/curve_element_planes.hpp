@@ -0,0 +1,399 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_CURVE_ELEMENT_PLANES_HPP
+#define CRYPTO3_MARSHALLING_CURVE_ELEMENT_PLANES_HPP
+
+#include <type_traits>
+#include <array>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/marshalling/types/algebra/field_element.hpp>
+#include <nil/crypto3/marshalling/types/algebra/curve_element.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /// @brief Structure-of-arrays layout of affine curve points.
+                /// @details The X and Y coordinates are stored in two separate planes of
+                ///     little endian 64-bit limbs. Every coordinate is padded to a whole
+                ///     number of 64-byte blocks and starts on a 64-byte boundary, so the
+                ///     planes can be fed to MSM and batch normalization kernels as is.
+                ///     Points at infinity are marked in a separate plane and have zero
+                ///     coordinates.
+                template<typename CurveGroupType>
+                class curve_element_coordinate_planes {
+                    using group_value_type = typename CurveGroupType::value_type;
+                    using field_type = typename group_value_type::underlying_field_type;
+
+                    static_assert(field_type::arity == 1, 
+                        "Coordinate planes are only defined for groups over a prime field");
+
+                public:
+                    using value_type = group_value_type;
+                    using modulus_type = typename field_type::modulus_type;
+                    using limb_type = std::uint64_t;
+
+                    constexpr static const std::size_t alignment = 64;
+                    constexpr static const std::size_t limb_bits = 
+                        sizeof(limb_type) * 8;
+                    constexpr static const std::size_t coordinate_limbs = 
+                        field_type::modulus_bits / limb_bits + 
+                        ((field_type::modulus_bits % limb_bits)?1:0);
+                    constexpr static const std::size_t block_limbs = 
+                        alignment / sizeof(limb_type);
+                    /// @brief Distance in limbs between consecutive coordinates of a plane.
+                    constexpr static const std::size_t stride = 
+                        ((coordinate_limbs + block_limbs - 1) / block_limbs) * block_limbs;
+
+                private:
+                    struct alignas(alignment) coordinate_type {
+                        std::array<limb_type, stride> limbs;
+                    };
+
+                    static_assert(sizeof(coordinate_type) == stride * sizeof(limb_type), 
+                        "Coordinates must be laid out without gaps");
+
+                public:
+                    curve_element_coordinate_planes() = default;
+
+                    explicit curve_element_coordinate_planes(std::size_t size) : 
+                        x_(size), y_(size), infinity_(size, 0) {
+                    }
+
+                    std::size_t size() const noexcept {
+                        return infinity_.size();
+                    }
+
+                    const limb_type *x_plane() const noexcept {
+                        return x_.empty() ? nullptr : x_.front().limbs.data();
+                    }
+
+                    const limb_type *y_plane() const noexcept {
+                        return y_.empty() ? nullptr : y_.front().limbs.data();
+                    }
+
+                    /// @brief One byte per point, non-zero for the point at infinity.
+                    const std::uint8_t *infinity_plane() const noexcept {
+                        return infinity_.data();
+                    }
+
+                    const limb_type *x(std::size_t i) const noexcept {
+                        return x_[i].limbs.data();
+                    }
+
+                    const limb_type *y(std::size_t i) const noexcept {
+                        return y_[i].limbs.data();
+                    }
+
+                    bool is_infinity(std::size_t i) const noexcept {
+                        return infinity_[i] != 0;
+                    }
+
+                    /// @details Points with Z == 1, such as decoded ones, are stored as is.
+                    ///     Any other point costs a field inversion, so vectors of those are
+                    ///     better normalized in one batch first.
+                    void set(std::size_t i, const value_type &point) {
+                        x_[i].limbs.fill(0);
+                        y_[i].limbs.fill(0);
+
+                        if (point.is_zero()) {
+                            infinity_[i] = 1;
+                            return;
+                        }
+                        infinity_[i] = 0;
+
+                        if (point.Z == field_type::value_type::one()) {
+                            set_coordinates(i, point);
+                        } else {
+                            set_coordinates(i, point.to_affine());
+                        }
+                    }
+
+                    value_type get(std::size_t i) const {
+                        if (is_infinity(i)) {
+                            return value_type::zero();
+                        }
+
+                        modulus_type x_value, y_value;
+                        multiprecision::import_bits(x_value, 
+                            x_[i].limbs.begin(), x_[i].limbs.begin() + coordinate_limbs, 
+                            limb_bits, false);
+                        multiprecision::import_bits(y_value, 
+                            y_[i].limbs.begin(), y_[i].limbs.begin() + coordinate_limbs, 
+                            limb_bits, false);
+
+                        return value_type(typename field_type::value_type(x_value), 
+                                          typename field_type::value_type(y_value), 
+                                          field_type::value_type::one());
+                    }
+
+                private:
+                    void set_coordinates(std::size_t i, const value_type &point_affine) {
+                        multiprecision::export_bits(
+                            point_affine.X.data.template convert_to<modulus_type>(), 
+                            x_[i].limbs.begin(), limb_bits, false);
+                        multiprecision::export_bits(
+                            point_affine.Y.data.template convert_to<modulus_type>(), 
+                            y_[i].limbs.begin(), limb_bits, false);
+                    }
+
+                    std::vector<coordinate_type> x_;
+                    std::vector<coordinate_type> y_;
+                    std::vector<std::uint8_t> infinity_;
+                };
+
+                template<typename CurveGroupType>
+                curve_element_coordinate_planes<CurveGroupType>
+                    fill_curve_element_coordinate_planes(
+                        const std::vector<typename CurveGroupType::value_type> &curve_elem_vector){
+
+                    std::vector<typename CurveGroupType::value_type> affine(curve_elem_vector.size());
+                    detail::batch_to_affine(curve_elem_vector.data(), curve_elem_vector.size(), 
+                                            affine.data());
+
+                    curve_element_coordinate_planes<CurveGroupType> result(affine.size());
+                    for (std::size_t i = 0; i < affine.size(); i++){
+                        result.set(i, affine[i]);
+                    }
+                    return result;
+                }
+
+                template<typename CurveGroupType, 
+                         typename Endianness>
+                curve_element_coordinate_planes<CurveGroupType>
+                    construct_curve_element_coordinate_planes(
+                        const nil::marshalling::types::array_list<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            curve_element<
+                                nil::marshalling::field_type<
+                                    Endianness>,
+                                CurveGroupType
+                            >,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                nil::marshalling::types::integral<
+                                    nil::marshalling::field_type<
+                                    Endianness>, 
+                                    std::size_t
+                                >
+                            > 
+                        > &curve_elem_vector){
+
+                    const auto &values = curve_elem_vector.value();
+                    std::vector<typename CurveGroupType::value_type> points;
+                    points.reserve(values.size());
+                    for (const auto &value : values){
+                        points.push_back(value.value());
+                    }
+
+                    return fill_curve_element_coordinate_planes<CurveGroupType>(points);
+                }
+
+                /// @brief Decode bytes written by write_curve_element_vector_data
+                ///     straight into coordinate planes.
+                /// @param[in, out] iter Iterator to read the data, advanced on success.
+                /// @param[in, out] size Number of bytes available for reading, decreased on success.
+                /// @param[out] status Status of read operation.
+                template<typename CurveGroupType, 
+                         typename Endianness, 
+                         typename TIter>
+                curve_element_coordinate_planes<CurveGroupType>
+                    read_curve_element_coordinate_planes_data(
+                        TIter &iter, 
+                        std::size_t &size, 
+                        nil::marshalling::status_type &status){
+
+                    using size_type = 
+                        nil::marshalling::types::integral<
+                            nil::marshalling::field_type<
+                                Endianness>, 
+                            std::size_t>;
+
+                    if (size < size_type::max_length()) {
+                        status = nil::marshalling::status_type::not_enough_data;
+                        return curve_element_coordinate_planes<CurveGroupType>();
+                    }
+                    size_type elements_count;
+                    status = elements_count.read(iter, size);
+                    size -= size_type::max_length();
+
+                    if (elements_count.value() > 
+                            size / curve_element_serialized_size<CurveGroupType, Endianness>()) {
+                        status = nil::marshalling::status_type::not_enough_data;
+                        return curve_element_coordinate_planes<CurveGroupType>();
+                    }
+
+                    curve_element_coordinate_planes<CurveGroupType> result(elements_count.value());
+                    for (std::size_t i = 0; 
+                         i < elements_count.value() && 
+                            status == nil::marshalling::status_type::success; 
+                         i++){
+                        result.set(i, 
+                            read_curve_element_data<CurveGroupType, Endianness>(iter, size, status));
+                    }
+                    return result;
+                }
+                /// @brief Fixed-size affine limb layout of a single curve point.
+                /// @details A point is stored as X followed by Y. Every base field
+                ///     component of a coordinate takes stride little endian 64-bit limbs,
+                ///     padded to whole 64-byte blocks. The point at infinity is stored
+                ///     as all zero limbs, which is not an affine point of the supported
+                ///     curves.
+                template<typename CurveGroupType>
+                struct affine_point_layout {
+                    using value_type = typename CurveGroupType::value_type;
+                    using field_type = typename value_type::underlying_field_type;
+                    using coordinate_number_type = field_coordinate_type<field_type>;
+                    using limb_type = std::uint64_t;
+
+                    constexpr static const std::size_t alignment = 64;
+                    constexpr static const std::size_t limb_bits = 
+                        sizeof(limb_type) * 8;
+                    constexpr static const std::size_t component_limbs = 
+                        field_type::modulus_bits / limb_bits + 
+                        ((field_type::modulus_bits % limb_bits)?1:0);
+                    constexpr static const std::size_t block_limbs = 
+                        alignment / sizeof(limb_type);
+                    constexpr static const std::size_t stride = 
+                        ((component_limbs + block_limbs - 1) / block_limbs) * block_limbs;
+                    constexpr static const std::size_t coordinate_limbs = 
+                        field_type::arity * stride;
+                    constexpr static const std::size_t point_limbs = 
+                        2 * coordinate_limbs;
+                    constexpr static const std::size_t point_size = 
+                        point_limbs * sizeof(limb_type);
+
+                    /// @pre out points to point_limbs zeroed limbs.
+                    static void write(const value_type &point, limb_type *out) {
+                        if (point.is_zero()) {
+                            return;
+                        }
+
+                        if (point.Z == field_type::value_type::one()) {
+                            write_coordinate(point.X, out);
+                            write_coordinate(point.Y, out + coordinate_limbs);
+                            return;
+                        }
+
+                        value_type point_affine = point.to_affine();
+                        write_coordinate(point_affine.X, out);
+                        write_coordinate(point_affine.Y, out + coordinate_limbs);
+                    }
+
+                    static value_type read(const limb_type *in) {
+                        if (std::all_of(in, in + point_limbs, 
+                                [](limb_type limb) { return limb == 0; })) {
+                            return value_type::zero();
+                        }
+
+                        return value_type(read_coordinate(in), 
+                                          read_coordinate(in + coordinate_limbs), 
+                                          field_type::value_type::one());
+                    }
+
+                private:
+                    static void write_coordinate(const typename field_type::value_type &coordinate, 
+                                                 limb_type *out) {
+                        const std::array<coordinate_number_type, field_type::arity> coordinate_data = 
+                            detail::obtain_field_data<field_type>(coordinate);
+                        for (std::size_t i = 0; i < field_type::arity; i++) {
+                            multiprecision::export_bits(coordinate_data[i], 
+                                out + i * stride, limb_bits, false);
+                        }
+                    }
+
+                    static typename field_type::value_type 
+                        read_coordinate(const limb_type *in) {
+                        std::array<coordinate_number_type, field_type::arity> coordinate_data;
+                        for (std::size_t i = 0; i < field_type::arity; i++) {
+                            multiprecision::import_bits(coordinate_data[i], 
+                                in + i * stride, in + i * stride + component_limbs, 
+                                limb_bits, false);
+                        }
+                        return detail::construct_field_element<field_type>(coordinate_data.begin());
+                    }
+                };
+
+                /// @brief Non-owning view of consecutive points in affine_point_layout.
+                template<typename CurveGroupType>
+                class affine_point_span {
+                public:
+                    using layout_type = affine_point_layout<CurveGroupType>;
+                    using value_type = typename layout_type::value_type;
+                    using limb_type = typename layout_type::limb_type;
+
+                    affine_point_span() = default;
+
+                    affine_point_span(const limb_type *data, std::size_t size) : 
+                        data_(data), size_(size) {
+                    }
+
+                    const limb_type *data() const noexcept {
+                        return data_;
+                    }
+
+                    std::size_t size() const noexcept {
+                        return size_;
+                    }
+
+                    bool empty() const noexcept {
+                        return size_ == 0;
+                    }
+
+                    /// @brief Limbs of the i-th point, X then Y.
+                    const limb_type *point(std::size_t i) const noexcept {
+                        return data_ + i * layout_type::point_limbs;
+                    }
+
+                    value_type get(std::size_t i) const {
+                        return layout_type::read(point(i));
+                    }
+
+                private:
+                    const limb_type *data_ = nullptr;
+                    std::size_t size_ = 0;
+                };
+
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_CURVE_ELEMENT_PLANES_HPP
@@ -29,6 +29,8 @@
 #include <ratio>
 #include <limits>
 #include <type_traits>
+#include <array>
+#include <vector>
 
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/options.hpp>
@@ -39,7 +41,10 @@
 
 #include <nil/crypto3/algebra/type_traits.hpp>
 
+#include <nil/crypto3/marshalling/processing/integral.hpp>
 #include <nil/crypto3/marshalling/types/integral.hpp>
+#include <nil/crypto3/marshalling/types/detail/parallel_ranges.hpp>
+#include <nil/crypto3/marshalling/types/detail/staging.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -58,46 +63,46 @@ namespace nil {
                         nil::marshalling::types::array_list<
                             nil::marshalling::field_type<
                             nil::marshalling::option::little_endian>,
-                            integral<
+                            field_coordinate_integral<
                                 TTypeBase, 
-                                typename FieldType::modulus_type>,
+                                FieldType>,
                             nil::marshalling::option::fixed_size_storage<
                                 FieldType::arity>
                         >,
-                        integral<
+                        field_coordinate_integral<
                             TTypeBase, 
-                            typename FieldType::modulus_type
+                            FieldType
                         >
                     >::type;
                 namespace detail {
                     template<typename FieldType>
                     typename std::enable_if<
                                 !(algebra::is_extended_field<FieldType>::value), 
-                                std::array<typename FieldType::modulus_type, 
+                                std::array<field_coordinate_type<FieldType>, 
                                     FieldType::arity>>::type
-                        obtain_field_data(typename FieldType::value_type field_elem){
+                        obtain_field_data(const typename FieldType::value_type &field_elem){
 
-                        std::array<typename FieldType::modulus_type, 
+                        std::array<field_coordinate_type<FieldType>, 
                                     FieldType::arity> result;
-                        result[0] = typename FieldType::modulus_type(field_elem.data);
+                        result[0] = field_coordinate_type<FieldType>(field_elem.data);
                         return result;
                     }
 
                     template<typename FieldType>
                     typename std::enable_if<
                                 algebra::is_extended_field<FieldType>::value, 
-                                std::array<typename FieldType::modulus_type, 
+                                std::array<field_coordinate_type<FieldType>, 
                                     FieldType::arity>>::type
-                        obtain_field_data(typename FieldType::value_type field_elem){
+                        obtain_field_data(const typename FieldType::value_type &field_elem){
                         
-                        std::array<typename FieldType::modulus_type, 
+                        std::array<field_coordinate_type<FieldType>, 
                                     FieldType::arity> result;
 
                         for (std::size_t i = 0; 
                              i < FieldType::arity/
                                 FieldType::underlying_field_type::arity;
                              i++){
-                            std::array<typename FieldType::modulus_type, 
+                            std::array<field_coordinate_type<FieldType>, 
                                 FieldType::underlying_field_type::arity> 
                                 intermediate_res = 
                                 obtain_field_data<
@@ -122,19 +127,19 @@ namespace nil {
                                 nil::marshalling::field_type<
                                 Endianness>,
                             FieldType>>::type
-                    fill_field_element(typename FieldType::value_type field_elem){
+                    fill_field_element(const typename FieldType::value_type &field_elem){
                     using field_element_type = field_element<
                         nil::marshalling::field_type<
                         Endianness>,
                         FieldType>;
-                    using integral_type = integral<
+                    using integral_type = field_coordinate_integral<
                         nil::marshalling::field_type<
                         Endianness>,
-                        typename FieldType::modulus_type>;
+                        FieldType>;
 
                     nil::marshalling::container::static_vector<
                         integral_type, FieldType::arity> container_data;
-                    std::array<typename FieldType::modulus_type, 
+                    std::array<field_coordinate_type<FieldType>, 
                         FieldType::arity> val_container = 
                         detail::obtain_field_data<FieldType>(field_elem);
                     for (std::size_t i=0;
@@ -155,64 +160,53 @@ namespace nil {
                                 nil::marshalling::field_type<
                                 Endianness>,
                             FieldType>>::type
-                    fill_field_element(typename FieldType::value_type field_elem){
+                    fill_field_element(const typename FieldType::value_type &field_elem){
                     using field_element_type = field_element<
                         nil::marshalling::field_type<
                         Endianness>,
                         FieldType>;
-                    using integral_type = integral<
+                    using integral_type = field_coordinate_integral<
                         nil::marshalling::field_type<
                         Endianness>,
-                        typename FieldType::modulus_type>;
+                        FieldType>;
 
                     return field_element_type(integral_type(
-                        typename FieldType::modulus_type(field_elem.data)));
+                        field_coordinate_type<FieldType>(field_elem.data)));
                 }
 
+                /// @brief Fill the field_element vector.
+                /// @details FieldElementVector may replace the element storage through
+                ///     nil::marshalling::option::custom_storage_type, e.g. with a
+                ///     std::pmr::vector, which is then constructed with allocator.
                 template<typename FieldType, 
-                         typename Endianness>
-                nil::marshalling::types::array_list<
-                    nil::marshalling::field_type<
-                            Endianness>,
-                    field_element<
-                        nil::marshalling::field_type<
-                            Endianness>,
-                        FieldType
-                    >,
-                    nil::marshalling::option::sequence_size_field_prefix<
-                        nil::marshalling::types::integral<
-                            nil::marshalling::field_type<
-                            Endianness>, 
-                            std::size_t
-                        >
-                    > 
-                >
-                    fill_field_element_vector(std::vector<typename FieldType::value_type> field_elem_vector){
-
-                    using TTypeBase = nil::marshalling::field_type<
-                                Endianness>;
-
-                    using field_element_type = 
-                        field_element<
-                            TTypeBase,
-                            FieldType
-                        >;
-
-                    using field_element_vector_type = 
-                        nil::marshalling::types::array_list<
-                            TTypeBase,
-                            field_element_type,
-                            nil::marshalling::option::sequence_size_field_prefix<
-                                nil::marshalling::types::integral<
-                                    TTypeBase, 
-                                    std::size_t
-                                >
-                            > 
-                        >;
-
-                    field_element_vector_type result;
-
-                    std::vector<field_element_type> &val = result.value();
+                         typename Endianness, 
+                         typename FieldElementVector = 
+                            nil::marshalling::types::array_list<
+                                nil::marshalling::field_type<
+                                        Endianness>,
+                                field_element<
+                                    nil::marshalling::field_type<
+                                        Endianness>,
+                                    FieldType
+                                >,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        nil::marshalling::field_type<
+                                        Endianness>, 
+                                        std::size_t
+                                    >
+                                > 
+                            >>
+                FieldElementVector
+                    fill_field_element_vector(const std::vector<typename FieldType::value_type> &field_elem_vector, 
+                                              const typename FieldElementVector::value_type::allocator_type &allocator = 
+                                                  typename FieldElementVector::value_type::allocator_type()){
+
+                    FieldElementVector result(
+                        typename FieldElementVector::value_type(allocator));
+
+                    auto &val = result.value();
+                    val.reserve(field_elem_vector.size());
                     for (std::size_t i=0; 
                          i<field_elem_vector.size();
                          i++){
@@ -230,11 +224,12 @@ namespace nil {
                                 typename FieldType::value_type
                              >::type
                         construct_field_element(typename std::array<
-                            typename FieldType::modulus_type, 
+                            field_coordinate_type<FieldType>, 
                             FieldType::arity>::iterator 
                             field_elem_data_iter){
                         
-                        return typename FieldType::value_type(*field_elem_data_iter);
+                        return typename FieldType::value_type(
+                            typename FieldType::modulus_type(*field_elem_data_iter));
                     }
 
                     template<typename FieldType>
@@ -243,7 +238,7 @@ namespace nil {
                                 typename FieldType::value_type
                              >::type
                         construct_field_element(typename std::array<
-                            typename FieldType::modulus_type, 
+                            field_coordinate_type<FieldType>, 
                             FieldType::arity>::iterator 
                             field_elem_data_iter){
                         
@@ -275,13 +270,13 @@ namespace nil {
                                 algebra::is_extended_field<FieldType>::value, 
                                 typename FieldType::value_type
                              >::type
-                    construct_field_element(field_element<
+                    construct_field_element(const field_element<
                                 nil::marshalling::field_type<
                                 Endianness>,
-                            FieldType> field_elem){
+                            FieldType> &field_elem){
 
                         std::array<
-                                typename FieldType::modulus_type, 
+                                field_coordinate_type<FieldType>, 
                                 FieldType::arity>
                                 field_elem_data;
 
@@ -303,20 +298,24 @@ namespace nil {
                                 !(algebra::is_extended_field<FieldType>::value), 
                                 typename FieldType::value_type
                              >::type
-                    construct_field_element(field_element<
+                    construct_field_element(const field_element<
                                 nil::marshalling::field_type<
                                 Endianness>,
-                            FieldType> field_elem){
+                            FieldType> &field_elem){
 
                         return typename FieldType::value_type(
-                                        field_elem.value());
+                                        typename FieldType::modulus_type(field_elem.value()));
                 }
 
+                /// @brief Construct the native elements of a field_element vector filled by
+                ///     fill_field_element_vector, into a Result constructed with allocator.
                 template<typename FieldType, 
-                         typename Endianness>
-                std::vector<typename FieldType::value_type>
+                         typename Endianness, 
+                         typename Result = std::vector<typename FieldType::value_type>, 
+                         typename... TOptions>
+                Result
                     construct_field_element_vector(
-                        nil::marshalling::types::array_list<
+                        const nil::marshalling::types::array_list<
                             nil::marshalling::field_type<
                                 Endianness>,
                             field_element<
@@ -324,22 +323,15 @@ namespace nil {
                                     Endianness>,
                                 FieldType
                             >,
-                            nil::marshalling::option::sequence_size_field_prefix<
-                                nil::marshalling::types::integral<
-                                    nil::marshalling::field_type<
-                                    Endianness>, 
-                                    std::size_t
-                                >
-                            > 
-                        > field_elem_vector){
-
-                    std::vector<typename FieldType::value_type> result;
-                    std::vector<field_element<
-                            nil::marshalling::field_type<
-                                Endianness>,
-                            FieldType
-                        >> &values = field_elem_vector.value();
+                            TOptions...
+                        > &field_elem_vector, 
+                        const typename Result::allocator_type &allocator = 
+                            typename Result::allocator_type()){
+
+                    Result result(allocator);
+                    const auto &values = field_elem_vector.value();
                     std::size_t size = values.size();
+                    result.reserve(size);
 
                     for (std::size_t i=0; 
                          i<size;
@@ -352,6 +344,201 @@ namespace nil {
                     }
                     return result;
                 }
+
+                template<typename FieldType, 
+                         typename Endianness>
+                constexpr std::size_t field_element_serialized_size() {
+                    return FieldType::arity * 
+                        field_coordinate_integral<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            FieldType>::max_length();
+                }
+
+                template<typename FieldType, 
+                         typename Endianness>
+                std::size_t field_element_vector_serialized_size(
+                    const std::vector<typename FieldType::value_type> &field_elem_vector) {
+                    return nil::marshalling::types::integral<
+                            nil::marshalling::field_type<
+                                Endianness>, 
+                            std::size_t>::max_length() + 
+                        field_elem_vector.size() * 
+                            field_element_serialized_size<FieldType, Endianness>();
+                }
+
+                /// @brief Write the element as field_element does, without constructing it.
+                /// @pre At least
+                ///     field_element_serialized_size() units can be written, unless the
+                ///     iterator is an output iterator such as std::back_inserter.
+                /// @post The iterator is advanced.
+                template<typename FieldType, 
+                         typename Endianness, 
+                         typename TIter>
+                void write_field_element_data(const typename FieldType::value_type &field_elem, 
+                                              TIter &iter) {
+                    using integral_type = 
+                        field_coordinate_integral<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            FieldType>;
+
+                    const std::array<field_coordinate_type<FieldType>, 
+                        FieldType::arity> field_elem_data = 
+                            detail::obtain_field_data<FieldType>(field_elem);
+                    for (const field_coordinate_type<FieldType> &coordinate : field_elem_data) {
+                        detail::write_staged<integral_type::max_length()>(iter, 
+                            [&coordinate](auto &block_iter) {
+                                processing::write_data<
+                                    integral_type::bit_length(), 
+                                    typename nil::marshalling::field_type<
+                                        Endianness>::endian_type>(coordinate, block_iter);
+                            });
+                    }
+                }
+
+                /// @brief Write the elements as the array_list produced by
+                ///     fill_field_element_vector does.
+                /// @post The iterator is advanced.
+                template<typename FieldType, 
+                         typename Endianness, 
+                         typename TIter>
+                void write_field_element_vector_data(
+                    const std::vector<typename FieldType::value_type> &field_elem_vector, 
+                    TIter &iter) {
+
+                    nil::marshalling::types::integral<
+                        nil::marshalling::field_type<
+                            Endianness>, 
+                        std::size_t> size(field_elem_vector.size());
+                    size.write(iter, size.length());
+
+                    for (const typename FieldType::value_type &field_elem : field_elem_vector) {
+                        write_field_element_data<FieldType, Endianness>(field_elem, iter);
+                    }
+                }
+                /// @brief Same as write_field_element_vector_data, with the elements split
+                ///     into ranges written concurrently, each straight to its offset.
+                /// @param[in] threads_count Number of ranges, 0 for one per hardware thread.
+                /// @post The iterator is advanced.
+                template<typename FieldType, 
+                         typename Endianness, 
+                         typename TIter>
+                void write_field_element_vector_data_parallel(
+                    const std::vector<typename FieldType::value_type> &field_elem_vector, 
+                    TIter &iter, 
+                    std::size_t threads_count = 0) {
+
+                    nil::marshalling::types::integral<
+                        nil::marshalling::field_type<
+                            Endianness>, 
+                        std::size_t> size(field_elem_vector.size());
+                    size.write(iter, size.length());
+
+                    detail::parallel_for_ranges(field_elem_vector.size(), threads_count, 
+                        [&field_elem_vector, iter](std::size_t begin, std::size_t end) {
+                            TIter range_iter = iter + 
+                                begin * field_element_serialized_size<FieldType, Endianness>();
+                            for (std::size_t i = begin; i < end; i++) {
+                                write_field_element_data<FieldType, Endianness>(
+                                    field_elem_vector[i], range_iter);
+                            }
+                        });
+
+                    iter += field_elem_vector.size() * 
+                        field_element_serialized_size<FieldType, Endianness>();
+                }
+
+                /// @brief Read an element written by write_field_element_data
+                ///     without constructing the field_element wrapper.
+                /// @param[in, out] iter Iterator to read the data, advanced on success.
+                /// @param[in, out] size Number of bytes available for reading, decreased on success.
+                /// @param[out] status Status of read operation.
+                template<typename FieldType, 
+                         typename Endianness, 
+                         typename TIter>
+                typename FieldType::value_type 
+                    read_field_element_data(TIter &iter, 
+                                            std::size_t &size, 
+                                            nil::marshalling::status_type &status) {
+                    using integral_type = 
+                        field_coordinate_integral<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            FieldType>;
+
+                    if (size < field_element_serialized_size<FieldType, Endianness>()) {
+                        status = nil::marshalling::status_type::not_enough_data;
+                        return typename FieldType::value_type();
+                    }
+
+                    std::array<field_coordinate_type<FieldType>, 
+                        FieldType::arity> field_elem_data;
+                    for (field_coordinate_type<FieldType> &coordinate : field_elem_data) {
+                        coordinate = detail::read_staged<
+                            field_coordinate_type<FieldType>, 
+                            integral_type::max_length()>(iter, 
+                            [](auto &block_iter) {
+                                return processing::read_data<
+                                    integral_type::bit_length(), 
+                                    field_coordinate_type<FieldType>, 
+                                    typename nil::marshalling::field_type<
+                                        Endianness>::endian_type>(block_iter);
+                            });
+                    }
+                    size -= field_element_serialized_size<FieldType, Endianness>();
+                    status = nil::marshalling::status_type::success;
+
+                    return detail::construct_field_element<FieldType>(field_elem_data.begin());
+                }
+
+                /// @brief Read elements written by write_field_element_vector_data.
+                /// @details The element count is validated against the available
+                ///     size before any storage is allocated. The elements are stored
+                ///     in a Result constructed with allocator.
+                template<typename FieldType, 
+                         typename Endianness, 
+                         typename Result = std::vector<typename FieldType::value_type>, 
+                         typename TIter>
+                Result
+                    read_field_element_vector_data(TIter &iter, 
+                                                   std::size_t &size, 
+                                                   nil::marshalling::status_type &status, 
+                                                   const typename Result::allocator_type &allocator = 
+                                                       typename Result::allocator_type()) {
+                    using size_type = 
+                        nil::marshalling::types::integral<
+                            nil::marshalling::field_type<
+                                Endianness>, 
+                            std::size_t>;
+
+                    Result result(allocator);
+
+                    if (size < size_type::max_length()) {
+                        status = nil::marshalling::status_type::not_enough_data;
+                        return result;
+                    }
+                    size_type elements_count;
+                    status = elements_count.read(iter, size);
+                    size -= size_type::max_length();
+
+                    if (elements_count.value() > 
+                            size / field_element_serialized_size<FieldType, Endianness>()) {
+                        status = nil::marshalling::status_type::not_enough_data;
+                        return result;
+                    }
+
+                    result.reserve(elements_count.value());
+                    for (std::size_t i = 0; 
+                         i < elements_count.value() && 
+                            status == nil::marshalling::status_type::success; 
+                         i++) {
+                        result.emplace_back(
+                            read_field_element_data<FieldType, Endianness>(iter, size, status));
+                    }
+                    return result;
+                }
+
             }    // namespace types
         }        // namespace marshalling
     }        // namespace crypto3
@@ -0,0 +1,240 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_G2_PRECOMP_HPP
+#define CRYPTO3_MARSHALLING_G2_PRECOMP_HPP
+
+#include <ratio>
+#include <limits>
+#include <type_traits>
+
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/types/tag.hpp>
+#include <nil/marshalling/types/detail/adapt_basic_field.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/marshalling/types/algebra/field_element.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /// @brief Miller loop line coefficients (ell_0, ell_VW, ell_VV) of the
+                ///     ate pairing, one entry of the G2 precomputation.
+                template<typename TTypeBase, 
+                         typename CurveType,
+                         typename... TOptions>
+                using ate_ell_coeffs = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // ell_0
+                            field_element<
+                                TTypeBase, 
+                                typename CurveType::g2_type::underlying_field_type
+                            >,
+                            // ell_VW
+                            field_element<
+                                TTypeBase, 
+                                typename CurveType::g2_type::underlying_field_type
+                            >,
+                            // ell_VV
+                            field_element<
+                                TTypeBase, 
+                                typename CurveType::g2_type::underlying_field_type
+                            >
+                        >
+                    >;
+
+                /// @brief Prepared G2 point of the ate pairing: affine coordinates of
+                ///     the point together with all the line coefficients the Miller
+                ///     loop consumes, so the verifier does not have to recompute them.
+                template<typename TTypeBase, 
+                         typename CurveType,
+                         typename... TOptions>
+                using g2_precomp = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // QX
+                            field_element<
+                                TTypeBase, 
+                                typename CurveType::g2_type::underlying_field_type
+                            >,
+                            // QY
+                            field_element<
+                                TTypeBase, 
+                                typename CurveType::g2_type::underlying_field_type
+                            >,
+                            // coeffs
+                            nil::marshalling::types::array_list<
+                                TTypeBase,
+                                ate_ell_coeffs<
+                                    TTypeBase, 
+                                    CurveType
+                                >,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        TTypeBase, 
+                                        std::size_t
+                                    >
+                                > 
+                            >
+                        >
+                    >;
+
+                template <typename CurveType, 
+                          typename Endianness>
+                g2_precomp<nil::marshalling::field_type<
+                                Endianness>,
+                                CurveType>
+                    fill_g2_precomp(const typename CurveType::pairing::g2_precomp &g2_precomp_inp){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using g2_field_type = 
+                        typename CurveType::g2_type::underlying_field_type;
+
+                    using ell_coeffs_type = 
+                        ate_ell_coeffs<
+                            TTypeBase,
+                            CurveType
+                        >;
+
+                    using ell_coeffs_vector_type = 
+                        nil::marshalling::types::array_list<
+                            TTypeBase,
+                            ell_coeffs_type,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                nil::marshalling::types::integral<
+                                    TTypeBase, 
+                                    std::size_t
+                                >
+                            > 
+                        >;
+
+                    ell_coeffs_vector_type filled_coeffs;
+
+                    std::vector<ell_coeffs_type> &filled_coeffs_val = filled_coeffs.value();
+                    filled_coeffs_val.reserve(g2_precomp_inp.coeffs.size());
+                    for (std::size_t i=0; 
+                         i<g2_precomp_inp.coeffs.size();
+                         i++){
+                        filled_coeffs_val.push_back(ell_coeffs_type(
+                            std::make_tuple(
+                                fill_field_element<g2_field_type, 
+                                    Endianness>(g2_precomp_inp.coeffs[i].ell_0),
+                                fill_field_element<g2_field_type, 
+                                    Endianness>(g2_precomp_inp.coeffs[i].ell_VW),
+                                fill_field_element<g2_field_type, 
+                                    Endianness>(g2_precomp_inp.coeffs[i].ell_VV))));
+                    }
+
+                    return g2_precomp<nil::marshalling::field_type<
+                                Endianness>,
+                                CurveType>(
+                                    std::make_tuple(
+                                        fill_field_element<g2_field_type, 
+                                            Endianness>(g2_precomp_inp.QX),
+                                        fill_field_element<g2_field_type, 
+                                            Endianness>(g2_precomp_inp.QY),
+                                        std::move(filled_coeffs)));
+                }
+
+                template <typename CurveType, 
+                          typename Endianness>
+                typename CurveType::pairing::g2_precomp
+                    construct_g2_precomp(
+                        const g2_precomp<nil::marshalling::field_type<
+                                Endianness>,
+                                CurveType> &filled_g2_precomp){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using g2_field_type = 
+                        typename CurveType::g2_type::underlying_field_type;
+
+                    using g2_precomp_type = 
+                        typename CurveType::pairing::g2_precomp;
+
+                    using ell_coeffs_type = 
+                        ate_ell_coeffs<
+                            TTypeBase,
+                            CurveType
+                        >;
+
+                    g2_precomp_type result;
+                    result.QX = construct_field_element<g2_field_type, 
+                        Endianness>(std::get<0>(filled_g2_precomp.value()));
+                    result.QY = construct_field_element<g2_field_type, 
+                        Endianness>(std::get<1>(filled_g2_precomp.value()));
+
+                    const std::vector<ell_coeffs_type> &filled_coeffs = 
+                        std::get<2>(filled_g2_precomp.value()).value();
+                    std::size_t size = filled_coeffs.size();
+
+                    result.coeffs.resize(size);
+                    for (std::size_t i=0; 
+                         i<size;
+                         i++){
+                        result.coeffs[i].ell_0 = construct_field_element<g2_field_type, 
+                            Endianness>(std::get<0>(filled_coeffs[i].value()));
+                        result.coeffs[i].ell_VW = construct_field_element<g2_field_type, 
+                            Endianness>(std::get<1>(filled_coeffs[i].value()));
+                        result.coeffs[i].ell_VV = construct_field_element<g2_field_type, 
+                            Endianness>(std::get<2>(filled_coeffs[i].value()));
+                    }
+
+                    return result;
+                }
+
+                template <typename CurveType, 
+                          typename Endianness>
+                std::size_t g2_precomp_serialized_size(
+                    const typename CurveType::pairing::g2_precomp &g2_precomp_inp){
+
+                    return (2 + 3 * g2_precomp_inp.coeffs.size()) * 
+                            field_element_serialized_size<
+                                typename CurveType::g2_type::underlying_field_type, 
+                                Endianness>() + 
+                        nil::marshalling::types::integral<
+                            nil::marshalling::field_type<
+                                Endianness>, 
+                            std::size_t>::max_length();
+                }
+
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_G2_PRECOMP_HPP
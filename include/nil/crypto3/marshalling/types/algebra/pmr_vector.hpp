@@ -0,0 +1,109 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_PMR_VECTOR_HPP
+#define CRYPTO3_MARSHALLING_PMR_VECTOR_HPP
+
+#include <type_traits>
+#include <memory_resource>
+#include <cstddef>
+
+#include <nil/marshalling/options.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+
+#include <nil/crypto3/marshalling/types/algebra/field_element.hpp>
+#include <nil/crypto3/marshalling/types/algebra/curve_element.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /// @brief field_element vector with the same wire format as the array_list
+                ///     returned by fill_field_element_vector, stored in a std::pmr::vector.
+                /// @details The elements are allocated from the memory resource the storage
+                ///     was constructed with, so a whole message can be decoded into a
+                ///     monotonic arena and released at once. Copies of the array_list use
+                ///     the default resource, as std::pmr::vector copies do; read() into an
+                ///     existing array_list keeps its resource. Fill it by passing it and the
+                ///     resource to fill_field_element_vector; construct_field_element_vector
+                ///     and read_field_element_vector_data likewise decode into a
+                ///     std::pmr::vector given as their Result.
+                template<typename TTypeBase, 
+                         typename FieldType>
+                using pmr_field_element_vector = 
+                    nil::marshalling::types::array_list<
+                        TTypeBase,
+                        field_element<
+                            TTypeBase, 
+                            FieldType
+                        >,
+                        nil::marshalling::option::sequence_size_field_prefix<
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >
+                        >,
+                        nil::marshalling::option::custom_storage_type<
+                            std::pmr::vector<
+                                field_element<
+                                    TTypeBase, 
+                                    FieldType
+                                >
+                            >
+                        >
+                    >;
+
+                /// @brief Same as pmr_field_element_vector for curve elements.
+                template<typename TTypeBase, 
+                         typename CurveGroupType>
+                using pmr_curve_element_vector = 
+                    nil::marshalling::types::array_list<
+                        TTypeBase,
+                        curve_element<
+                            TTypeBase, 
+                            CurveGroupType
+                        >,
+                        nil::marshalling::option::sequence_size_field_prefix<
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >
+                        >,
+                        nil::marshalling::option::custom_storage_type<
+                            std::pmr::vector<
+                                curve_element<
+                                    TTypeBase, 
+                                    CurveGroupType
+                                >
+                            >
+                        >
+                    >;
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_PMR_VECTOR_HPP
@@ -0,0 +1,75 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_TYPES_DETAIL_PARALLEL_RANGES_HPP
+#define CRYPTO3_MARSHALLING_TYPES_DETAIL_PARALLEL_RANGES_HPP
+
+#include <algorithm>
+#include <vector>
+#include <future>
+#include <thread>
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+                namespace detail {
+                    /// @brief Split [0, size) into at most threads_count contiguous ranges
+                    ///     and call f(begin, end) for each of them concurrently. The first
+                    ///     range runs on the calling thread.
+                    /// @param[in] threads_count Number of ranges, 0 for one per hardware thread.
+                    template<typename F>
+                    void parallel_for_ranges(std::size_t size, 
+                                             std::size_t threads_count, 
+                                             F f) {
+                        if (threads_count == 0) {
+                            threads_count = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+                        }
+                        threads_count = std::min(threads_count, size);
+                        if (threads_count <= 1) {
+                            f(std::size_t(0), size);
+                            return;
+                        }
+
+                        const std::size_t range_size = (size + threads_count - 1) / threads_count;
+                        std::vector<std::future<void>> tasks;
+                        tasks.reserve(threads_count - 1);
+                        for (std::size_t begin = range_size; begin < size; begin += range_size) {
+                            tasks.emplace_back(std::async(std::launch::async, 
+                                f, begin, std::min(begin + range_size, size)));
+                        }
+                        f(std::size_t(0), range_size);
+
+                        for (std::future<void> &task : tasks) {
+                            task.get();
+                        }
+                    }
+                }    // namespace detail
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_TYPES_DETAIL_PARALLEL_RANGES_HPP
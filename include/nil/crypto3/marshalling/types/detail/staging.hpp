@@ -0,0 +1,108 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_TYPES_DETAIL_STAGING_HPP
+#define CRYPTO3_MARSHALLING_TYPES_DETAIL_STAGING_HPP
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+                namespace detail {
+                    template<typename TIter>
+                    using is_random_access_iterator = 
+                        std::is_base_of<std::random_access_iterator_tag, 
+                            typename std::iterator_traits<TIter>::iterator_category>;
+
+                    /// @brief Write a block of Length units with write(block_iter), which
+                    ///     needs random access and does not advance its iterator.
+                    /// @details Random access iterators are written in place. Output and
+                    ///     forward iterators, such as std::back_inserter, get the block
+                    ///     assembled in a zero-filled staging array and copied at once.
+                    /// @post The iterator is advanced by Length units.
+                    template<std::size_t Length, 
+                             typename TIter, 
+                             typename WriteBlock>
+                    typename std::enable_if<is_random_access_iterator<TIter>::value>::type
+                        write_staged(TIter &iter, WriteBlock write) {
+                        write(iter);
+                        iter += Length;
+                    }
+
+                    template<std::size_t Length, 
+                             typename TIter, 
+                             typename WriteBlock>
+                    typename std::enable_if<!is_random_access_iterator<TIter>::value>::type
+                        write_staged(TIter &iter, WriteBlock write) {
+                        std::array<std::uint8_t, Length> block = {};
+                        std::uint8_t *block_iter = block.data();
+                        write(block_iter);
+                        iter = std::copy(block.begin(), block.end(), iter);
+                    }
+
+                    /// @brief Read a block of Length units with read(block_iter), which
+                    ///     needs random access and does not advance its iterator.
+                    /// @details Random access iterators are read in place. Single-pass
+                    ///     iterators, such as std::istreambuf_iterator, are drained into
+                    ///     a staging array first.
+                    /// @post The iterator is advanced by Length units.
+                    template<typename Result, 
+                             std::size_t Length, 
+                             typename TIter, 
+                             typename ReadBlock>
+                    typename std::enable_if<is_random_access_iterator<TIter>::value, Result>::type
+                        read_staged(TIter &iter, ReadBlock read) {
+                        Result result = read(iter);
+                        iter += Length;
+                        return result;
+                    }
+
+                    template<typename Result, 
+                             std::size_t Length, 
+                             typename TIter, 
+                             typename ReadBlock>
+                    typename std::enable_if<!is_random_access_iterator<TIter>::value, Result>::type
+                        read_staged(TIter &iter, ReadBlock read) {
+                        std::array<std::uint8_t, Length> block;
+                        for (std::uint8_t &unit : block) {
+                            unit = static_cast<std::uint8_t>(*iter);
+                            ++iter;
+                        }
+                        const std::uint8_t *block_iter = block.data();
+                        return read(block_iter);
+                    }
+                }    // namespace detail
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_TYPES_DETAIL_STAGING_HPP
@@ -39,9 +39,11 @@
 #include <nil/marshalling/types/detail/adapt_basic_field.hpp>
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/options.hpp>
+#include <nil/marshalling/field_type.hpp>
 
 #include <nil/crypto3/marshalling/types/integral/basic_fixed_precision_type.hpp>
 #include <nil/crypto3/marshalling/types/integral/basic_non_fixed_precision_type.hpp>
+#include <nil/crypto3/marshalling/types/integral/fixed_precision_backend.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -159,8 +161,26 @@ namespace nil {
                     }
 
                     /// @brief Get length required to serialise the current field value.
+                    /// @details Static for fixed precision backends, whose length does
+                    ///     not depend on the value.
                     /// @return Number of bytes it will take to serialise the field value.
-                    static constexpr std::size_t  length() {
+                    template<typename B = Backend, 
+                             typename std::enable_if<
+                                 multiprecision::backends::is_fixed_precision<B>::value, 
+                                 bool>::type = true>
+                    static constexpr std::size_t length() {
+                        return base_impl_type::length();
+                    }
+
+                    /// @brief Get length required to serialise the current field value.
+                    /// @details Non-fixed precision backends write the minimal
+                    ///     representation of the value.
+                    /// @return Number of bytes it will take to serialise the field value.
+                    template<typename B = Backend, 
+                             typename std::enable_if<
+                                 !multiprecision::backends::is_fixed_precision<B>::value, 
+                                 bool>::type = true>
+                    std::size_t length() const {
                         return base_impl_type::length();
                     }
 
@@ -424,7 +444,7 @@ namespace nil {
                         >
                     > 
                 >
-                    fill_integral_vector(std::vector<IntegralContainer> integral_vector){
+                    fill_integral_vector(const std::vector<IntegralContainer> &integral_vector){
 
                     using TTypeBase = nil::marshalling::field_type<
                                 Endianness>;
@@ -451,6 +471,7 @@ namespace nil {
                     integral_vector_type result;
 
                     std::vector<integral_type> &val = result.value();
+                    val.reserve(integral_vector.size());
                     for (std::size_t i=0; 
                          i<integral_vector.size();
                          i++){
@@ -460,6 +481,99 @@ namespace nil {
                     return result;
                 }
 
+                template<typename IntegralContainer, 
+                         typename Endianness>
+                nil::marshalling::types::array_list<
+                    nil::marshalling::field_type<
+                            Endianness>,
+                    integral<
+                        nil::marshalling::field_type<
+                            Endianness>,
+                        IntegralContainer>,
+                    nil::marshalling::option::sequence_size_field_prefix<
+                        nil::marshalling::types::integral<
+                            nil::marshalling::field_type<
+                            Endianness>, 
+                            std::size_t
+                        >
+                    > 
+                >
+                    fill_integral_vector(std::vector<IntegralContainer> &&integral_vector){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using integral_type = 
+                        integral<
+                            TTypeBase,
+                            IntegralContainer
+                        >;
+
+                    using integral_vector_type = 
+                        nil::marshalling::types::array_list<
+                            TTypeBase,
+                            integral_type, 
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                nil::marshalling::types::integral<
+                                    nil::marshalling::field_type<
+                                    Endianness>, 
+                                    std::size_t
+                                >
+                            > 
+                        >;
+
+                    integral_vector_type result;
+
+                    std::vector<integral_type> &val = result.value();
+                    val.reserve(integral_vector.size());
+                    for (std::size_t i=0; 
+                         i<integral_vector.size();
+                         i++){
+                        val.push_back(integral_type(
+                            std::move(integral_vector[i])));
+                    }
+                    return result;
+                }
+
+                template<typename IntegralContainer, 
+                         typename Endianness>
+                std::vector<IntegralContainer>
+                    construct_integral_vector(
+                        const nil::marshalling::types::array_list<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            integral<
+                                nil::marshalling::field_type<
+                                    Endianness>,
+                                IntegralContainer
+                            >,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                nil::marshalling::types::integral<
+                                    nil::marshalling::field_type<
+                                    Endianness>, 
+                                    std::size_t
+                                >
+                            > 
+                        > &integral_vector){
+
+                    std::vector<IntegralContainer> result;
+                    const std::vector<integral<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            IntegralContainer
+                        >> &values = integral_vector.value();
+                    std::size_t size = values.size();
+                    result.reserve(size);
+
+                    for (std::size_t i=0; 
+                         i<size;
+                         i++){
+                        result.push_back(
+                            values[i].value());
+                    }
+                    return result;
+                }
+
                 template<typename IntegralContainer, 
                          typename Endianness>
                 std::vector<IntegralContainer>
@@ -479,7 +593,7 @@ namespace nil {
                                     std::size_t
                                 >
                             > 
-                        > integral_vector){
+                        > &&integral_vector){
 
                     std::vector<IntegralContainer> result;
                     std::vector<integral<
@@ -488,15 +602,36 @@ namespace nil {
                             IntegralContainer
                         >> &values = integral_vector.value();
                     std::size_t size = values.size();
+                    result.reserve(size);
 
                     for (std::size_t i=0; 
                          i<size;
                          i++){
                         result.push_back(
-                            values[i].value());
+                            std::move(values[i].value()));
                     }
                     return result;
                 }
+
+                /// @brief Integral holding one base field coordinate. Always fixed
+                ///     precision, so reading it never allocates.
+                template<typename TTypeBase, 
+                         typename FieldType>
+                using field_coordinate_integral = 
+                    integral<
+                        TTypeBase, 
+                        field_coordinate_type<FieldType>>;
+
+                /// @brief Number of bytes the integral holding the value writes. Does not
+                ///     depend on the value for fixed precision types.
+                template<typename Endianness, 
+                         typename IntegralContainer>
+                std::size_t integral_serialized_size(const IntegralContainer &integral_value){
+                    return integral<
+                            nil::marshalling::field_type<
+                                Endianness>, 
+                            IntegralContainer>(integral_value).length();
+                }
             }    // namespace types
         }        // namespace marshalling
     }        // namespace crypto3
@@ -38,6 +38,7 @@
 
 #include <nil/crypto3/marshalling/processing/integral.hpp>
 #include <nil/crypto3/marshalling/types/integral/basic_type.hpp>
+#include <nil/crypto3/marshalling/types/detail/staging.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -129,8 +130,13 @@ namespace nil {
                             //     return nil::marshalling::status_type::not_enough_data;
                             // }
 
-                            read_no_status(iter);
-                            iter += max_length();
+                            value_ = read_staged<value_type, max_length()>(iter, 
+                                [](auto &block_iter) {
+                                    return crypto3::marshalling::
+                                        processing::read_data<bit_length(), 
+                                            value_type, 
+                                            typename base_impl_type::endian_type>(block_iter);
+                                });
                             return nil::marshalling::status_type::success;
                         }
 
@@ -148,9 +154,10 @@ namespace nil {
                             //     return nil::marshalling::status_type::buffer_overflow;
                             // }
 
-                            write_no_status(iter);
-
-                            iter += max_length();
+                            write_staged<max_length()>(iter, 
+                                [this](auto &block_iter) {
+                                    write_no_status(block_iter);
+                                });
                             return nil::marshalling::status_type::success;
                         }
 
@@ -27,6 +27,7 @@
 #define CRYPTO3_MARSHALLING_BASIC_INTEGRAL_NON_FIXED_PRECISION_HPP
 
 #include <type_traits>
+#include <climits>
 
 #include <boost/type_traits/is_integral.hpp>
 
@@ -82,16 +83,26 @@ namespace nil {
                             return value_;
                         }
 
-                        static constexpr std::size_t length() {
-                            return sizeof(serialized_type);
+                        /// @brief Number of bytes write() produces: the minimal representation
+                        ///     of the value, and a single byte for zero.
+                        std::size_t length() const {
+                            return value_.is_zero() ? 1 : 
+                                multiprecision::msb(value_) / 8 + 1;
                         }
 
                         static constexpr std::size_t min_length() {
-                            return length();
+                            return 1;
                         }
 
                         static constexpr std::size_t max_length() {
-                            return length();
+                            return max_bit_length()/8 + 
+                            ((max_bit_length()%8)?1:0);
+                        }
+
+                        static constexpr std::size_t max_bit_length() {
+                            return nil::crypto3::multiprecision::backends::max_precision<Backend>::value == UINT_MAX ?
+                                INT_MAX :
+                                nil::crypto3::multiprecision::backends::max_precision<Backend>::value;
                         }
 
                         static constexpr serialized_type to_serialized(value_type val) {
@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_FIXED_PRECISION_BACKEND_HPP
+#define CRYPTO3_MARSHALLING_FIXED_PRECISION_BACKEND_HPP
+
+#include <type_traits>
+#include <cstddef>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /// @brief Unsigned backend of exactly Bits bits. Its limbs are stored
+                ///     inline, so numbers using it never allocate.
+                template<std::size_t Bits>
+                using fixed_precision_backend = 
+                    multiprecision::cpp_int_backend<
+                        Bits, 
+                        Bits, 
+                        multiprecision::unsigned_magnitude, 
+                        multiprecision::unchecked, 
+                        void>;
+
+                template<std::size_t Bits>
+                using fixed_precision_number = 
+                    multiprecision::number<
+                        fixed_precision_backend<Bits>>;
+
+                namespace detail {
+                    template<typename FieldType>
+                    struct field_coordinate {
+                        /// The field's own modulus_type when it is fixed precision,
+                        /// otherwise a fixed precision number of modulus_bits bits.
+                        using type = typename std::conditional<
+                            multiprecision::backends::is_fixed_precision<
+                                typename FieldType::modulus_type::backend_type>::value, 
+                            typename FieldType::modulus_type, 
+                            fixed_precision_number<FieldType::modulus_bits>>::type;
+
+                        static_assert(multiprecision::backends::is_fixed_precision<
+                                typename type::backend_type>::value, 
+                            "Field coordinates must use a fixed precision backend");
+                    };
+                }    // namespace detail
+
+                /// @brief Number type used to marshal a single base field coordinate.
+                template<typename FieldType>
+                using field_coordinate_type = 
+                    typename detail::field_coordinate<FieldType>::type;
+
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_FIXED_PRECISION_BACKEND_HPP
@@ -0,0 +1,144 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_PARALLEL_ARRAY_LIST_HPP
+#define CRYPTO3_MARSHALLING_PARALLEL_ARRAY_LIST_HPP
+
+#include <type_traits>
+#include <vector>
+#include <cstddef>
+
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/marshalling/types/detail/parallel_ranges.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                namespace detail {
+                    /// @brief Whether the layout of TList is its elements, optionally
+                    ///     preceded by an element count.
+                    template<typename TList>
+                    struct is_array_list_parallel_writable {
+                        using parsed_options_type = typename TList::parsed_options_type;
+
+                        static const bool value = 
+                            !parsed_options_type::has_sequence_ser_length_field_prefix && 
+                            !parsed_options_type::has_sequence_elem_ser_length_field_prefix && 
+                            !parsed_options_type::has_sequence_elem_fixed_ser_length_field_prefix && 
+                            !parsed_options_type::has_sequence_trailing_field_suffix && 
+                            !parsed_options_type::has_sequence_termination_field_suffix;
+                    };
+
+                    template<typename TList, 
+                             typename TIter>
+                    void write_array_list_size_prefix(const TList &, TIter &, std::false_type) {
+                    }
+
+                    template<typename TList, 
+                             typename TIter>
+                    void write_array_list_size_prefix(const TList &list, TIter &iter, std::true_type) {
+                        using prefix_type = 
+                            typename TList::parsed_options_type::sequence_size_field_prefix;
+
+                        prefix_type prefix(list.value().size());
+                        prefix.write(iter, prefix.length());
+                    }
+                }    // namespace detail
+
+                /// @brief Write an array_list of fixed length elements, such as integral,
+                ///     field_element or curve_element, with the elements split into
+                ///     ranges written concurrently.
+                /// @details Element i always sits at the prefix plus i times the element
+                ///     length, so every range is written straight to its place. Produces
+                ///     the same bytes as array_list::write. The element count prefix is the
+                ///     list's own sequence_size_field_prefix, so it keeps the list's type and
+                ///     endianness. Lists with any other prefix or suffix option are written
+                ///     sequentially. Every element is written by its own write(), so a list
+                ///     of curve_element normalizes its points one at a time; write native
+                ///     points with write_curve_element_vector_data_parallel to share one
+                ///     inversion per range instead.
+                /// @param[in, out] list_iter Random access iterator to write the data,
+                ///     advanced by the length of the list on success.
+                /// @param[in] size Number of bytes available for writing.
+                /// @param[in] threads_count Number of ranges, 0 for one per hardware thread.
+                /// @return buffer_overflow if size is too small, otherwise the status of
+                ///     the first element that failed to write, or success.
+                template<typename TList, 
+                         typename TIter>
+                nil::marshalling::status_type write_array_list_parallel(const TList &list, 
+                                                                        TIter &list_iter, 
+                                                                        std::size_t size, 
+                                                                        std::size_t threads_count = 0) {
+                    using element_type = typename TList::value_type::value_type;
+
+                    static_assert(element_type::min_length() == element_type::max_length(), 
+                        "Parallel list writing requires fixed length elements");
+
+                    if (!detail::is_array_list_parallel_writable<TList>::value) {
+                        return list.write(list_iter, size);
+                    }
+
+                    const auto &elements = list.value();
+                    const std::size_t length = list.length();
+                    if (length > size) {
+                        return nil::marshalling::status_type::buffer_overflow;
+                    }
+
+                    TIter iter = list_iter;
+                    detail::write_array_list_size_prefix(list, iter, 
+                        std::integral_constant<bool, 
+                            TList::parsed_options_type::has_sequence_size_field_prefix>());
+
+                    std::vector<nil::marshalling::status_type> elements_status(
+                        elements.size(), nil::marshalling::status_type::success);
+                    detail::parallel_for_ranges(elements.size(), threads_count, 
+                        [&elements, &elements_status, iter](std::size_t begin, std::size_t end) {
+                            TIter range_iter = iter + begin * element_type::max_length();
+                            for (std::size_t i = begin; i < end; i++) {
+                                elements_status[i] = 
+                                    elements[i].write(range_iter, element_type::max_length());
+                                if (elements_status[i] != nil::marshalling::status_type::success) {
+                                    return;
+                                }
+                            }
+                        });
+
+                    for (nil::marshalling::status_type element_status : elements_status) {
+                        if (element_status != nil::marshalling::status_type::success) {
+                            return element_status;
+                        }
+                    }
+
+                    list_iter += length;
+                    return nil::marshalling::status_type::success;
+                }
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_PARALLEL_ARRAY_LIST_HPP
@@ -0,0 +1,291 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_PARALLEL_BUNDLE_HPP
+#define CRYPTO3_MARSHALLING_PARALLEL_BUNDLE_HPP
+
+#include <type_traits>
+#include <tuple>
+#include <vector>
+#include <future>
+#include <limits>
+#include <utility>
+
+#include <nil/marshalling/status_type.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+                namespace detail {
+                    constexpr static const std::size_t parallel_bundle_unknown_length = 
+                        std::numeric_limits<std::size_t>::max();
+
+                    /// @brief Members shorter than this are written and read on the
+                    ///     calling thread, as a task would cost more than the member.
+                    constexpr static const std::size_t parallel_bundle_min_task_length = 
+                        std::size_t(1) << 16;
+
+                    /// @brief Whether TField is a list of fixed length elements whose
+                    ///     only prefix is an element count.
+                    template<typename TField, 
+                             typename = void>
+                    struct is_counted_fixed_length_list : std::false_type {
+                    };
+
+                    template<typename TField>
+                    struct is_counted_fixed_length_list<TField, 
+                        std::void_t<decltype(TField::value_type::value_type::max_length())>> : 
+                        std::integral_constant<bool, 
+                            TField::parsed_options_type::has_sequence_size_field_prefix && 
+                            !TField::parsed_options_type::has_sequence_ser_length_field_prefix && 
+                            !TField::parsed_options_type::has_sequence_elem_ser_length_field_prefix && 
+                            !TField::parsed_options_type::has_sequence_elem_fixed_ser_length_field_prefix && 
+                            !TField::parsed_options_type::has_sequence_trailing_field_suffix && 
+                            !TField::parsed_options_type::has_sequence_termination_field_suffix && 
+                            TField::value_type::value_type::min_length() == 
+                                TField::value_type::value_type::max_length()> {
+                    };
+
+                    /// @brief Serialized length of a list of fixed length elements,
+                    ///     computed from its element count prefix alone.
+                    template<typename TField, 
+                             typename TIter>
+                    std::size_t parallel_bundle_list_length(TIter iter, 
+                                                            std::size_t size, 
+                                                            std::true_type) {
+
+                        using element_type = typename TField::value_type::value_type;
+                        using prefix_type = 
+                            typename TField::parsed_options_type::sequence_size_field_prefix;
+
+                        prefix_type elements_count;
+                        if (size < prefix_type::max_length() || 
+                            elements_count.read(iter, size) != nil::marshalling::status_type::success) {
+                            return parallel_bundle_unknown_length;
+                        }
+
+                        const std::size_t prefix_length = elements_count.length();
+                        if (static_cast<std::size_t>(elements_count.value()) > 
+                                (size - prefix_length) / element_type::max_length()) {
+                            return parallel_bundle_unknown_length;
+                        }
+                        return prefix_length + 
+                            static_cast<std::size_t>(elements_count.value()) * element_type::max_length();
+                    }
+
+                    template<typename TField, 
+                             typename TIter>
+                    std::size_t parallel_bundle_list_length(TIter, std::size_t, std::false_type) {
+                        return parallel_bundle_unknown_length;
+                    }
+
+                    template<std::size_t I, 
+                             typename TBundle, 
+                             typename TIter>
+                    void parallel_bundle_read(TBundle &bundle, 
+                                              TIter iter, 
+                                              std::size_t size, 
+                                              std::size_t min_task_length, 
+                                              std::size_t &offset, 
+                                              std::vector<std::future<nil::marshalling::status_type>> &tasks, 
+                                              nil::marshalling::status_type &status) {
+
+                        using members_type = typename TBundle::value_type;
+
+                        if constexpr (I < std::tuple_size<members_type>::value) {
+                            using member_type = typename std::tuple_element<I, members_type>::type;
+
+                            member_type &member = std::get<I>(bundle.value());
+                            TIter member_iter = iter + offset;
+                            const std::size_t available = size - offset;
+
+                            std::size_t length = parallel_bundle_unknown_length;
+                            if (member_type::min_length() == member_type::max_length()) {
+                                length = member_type::max_length();
+                            } else if (I + 1 == std::tuple_size<members_type>::value) {
+                                length = available;
+                            } else {
+                                length = parallel_bundle_list_length<member_type>(
+                                    member_iter, available, 
+                                    is_counted_fixed_length_list<member_type>());
+                            }
+
+                            if (length == parallel_bundle_unknown_length) {
+                                // the extent is only known after decoding
+                                status = member.read(member_iter, available);
+                                if (status != nil::marshalling::status_type::success) {
+                                    return;
+                                }
+                                length = member.length();
+                            } else if (length > available) {
+                                status = nil::marshalling::status_type::not_enough_data;
+                                return;
+                            } else if (length < min_task_length) {
+                                status = member.read(member_iter, length);
+                                if (status != nil::marshalling::status_type::success) {
+                                    return;
+                                }
+                            } else {
+                                tasks.emplace_back(std::async(std::launch::async, 
+                                    [&member, member_iter, length]() mutable {
+                                        return member.read(member_iter, length);
+                                    }));
+                            }
+
+                            offset += length;
+                            parallel_bundle_read<I + 1>(
+                                bundle, iter, size, min_task_length, offset, tasks, status);
+                        }
+                    }
+
+                    template<std::size_t... I, 
+                             typename TBundle, 
+                             typename TIter>
+                    nil::marshalling::status_type parallel_bundle_write(const TBundle &bundle, 
+                                                                        TIter iter, 
+                                                                        std::size_t size, 
+                                                                        std::size_t min_task_length, 
+                                                                        std::index_sequence<I...>) {
+
+                        const std::size_t lengths[] = {std::get<I>(bundle.value()).length()...};
+                        std::size_t offsets[sizeof...(I)];
+                        std::size_t offset = 0;
+                        for (std::size_t i = 0; i < sizeof...(I); i++) {
+                            offsets[i] = offset;
+                            offset += lengths[i];
+                        }
+                        if (offset > size) {
+                            return nil::marshalling::status_type::buffer_overflow;
+                        }
+
+                        std::vector<std::future<nil::marshalling::status_type>> tasks;
+                        tasks.reserve(sizeof...(I));
+                        auto launch_member = [&](auto index) {
+                            constexpr std::size_t i = decltype(index)::value;
+                            if (lengths[i] >= min_task_length) {
+                                tasks.emplace_back(std::async(std::launch::async, 
+                                    [&bundle, member_iter = iter + offsets[i], length = lengths[i]]() mutable {
+                                        return std::get<i>(bundle.value()).write(member_iter, length);
+                                    }));
+                            }
+                        };
+                        (launch_member(std::integral_constant<std::size_t, I>()), ...);
+
+                        // small members are written here while the large ones are in flight
+                        nil::marshalling::status_type status = nil::marshalling::status_type::success;
+                        auto write_member = [&](auto index) {
+                            constexpr std::size_t i = decltype(index)::value;
+                            if (lengths[i] < min_task_length) {
+                                TIter member_iter = iter + offsets[i];
+                                nil::marshalling::status_type member_status = 
+                                    std::get<i>(bundle.value()).write(member_iter, lengths[i]);
+                                if (status == nil::marshalling::status_type::success) {
+                                    status = member_status;
+                                }
+                            }
+                        };
+                        (write_member(std::integral_constant<std::size_t, I>()), ...);
+
+                        for (std::future<nil::marshalling::status_type> &task : tasks) {
+                            nil::marshalling::status_type task_status = task.get();
+                            if (status == nil::marshalling::status_type::success) {
+                                status = task_status;
+                            }
+                        }
+                        return status;
+                    }
+                }    // namespace detail
+
+                /// @brief Write the members of a bundle concurrently.
+                /// @details Every member's offset is computed from the lengths of the
+                ///     members before it, and each member is then written to its own
+                ///     range of the output. Members of at least min_task_length bytes
+                ///     get a task each, smaller ones are written on the calling thread.
+                ///     Produces the same bytes as bundle::write.
+                /// @param[in, out] bundle_iter Random access iterator to write the data,
+                ///     advanced by the length of the bundle on success.
+                /// @param[in] size Number of bytes available for writing.
+                template<typename TBundle, 
+                         typename TIter>
+                nil::marshalling::status_type write_bundle_parallel(
+                    const TBundle &bundle, 
+                    TIter &bundle_iter, 
+                    std::size_t size, 
+                    std::size_t min_task_length = detail::parallel_bundle_min_task_length) {
+
+                    nil::marshalling::status_type status = 
+                        detail::parallel_bundle_write(bundle, bundle_iter, size, min_task_length, 
+                            std::make_index_sequence<
+                                std::tuple_size<typename TBundle::value_type>::value>());
+                    if (status == nil::marshalling::status_type::success) {
+                        bundle_iter += bundle.length();
+                    }
+                    return status;
+                }
+
+                /// @brief Read the members of a bundle concurrently.
+                /// @details The offset of every member is computed before decoding it:
+                ///     fixed length members take max_length() bytes, lists of fixed
+                ///     length elements with a sequence_size_field_prefix take the length
+                ///     implied by the prefix, and the last member takes whatever remains.
+                ///     Members whose extent cannot be determined that way, or which are
+                ///     shorter than min_task_length, are decoded on the calling thread
+                ///     while the others are in flight.
+                /// @param[in, out] bundle_iter Random access iterator to read the data,
+                ///     advanced by the length of the bundle on success.
+                /// @param[in] size Number of bytes available for reading.
+                template<typename TBundle, 
+                         typename TIter>
+                nil::marshalling::status_type read_bundle_parallel(
+                    TBundle &bundle, 
+                    TIter &bundle_iter, 
+                    std::size_t size, 
+                    std::size_t min_task_length = detail::parallel_bundle_min_task_length) {
+
+                    std::vector<std::future<nil::marshalling::status_type>> tasks;
+                    tasks.reserve(std::tuple_size<typename TBundle::value_type>::value);
+
+                    std::size_t offset = 0;
+                    nil::marshalling::status_type status = nil::marshalling::status_type::success;
+                    detail::parallel_bundle_read<0>(
+                        bundle, bundle_iter, size, min_task_length, offset, tasks, status);
+
+                    for (std::future<nil::marshalling::status_type> &task : tasks) {
+                        nil::marshalling::status_type task_status = task.get();
+                        if (status == nil::marshalling::status_type::success) {
+                            status = task_status;
+                        }
+                    }
+                    if (status == nil::marshalling::status_type::success) {
+                        bundle_iter += bundle.length();
+                    }
+                    return status;
+                }
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_PARALLEL_BUNDLE_HPP
@@ -0,0 +1,211 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_SECTION_TABLE_HPP
+#define CRYPTO3_MARSHALLING_SECTION_TABLE_HPP
+
+#include <type_traits>
+#include <array>
+#include <tuple>
+#include <utility>
+
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /// @brief Location of a section within a sectioned container.
+                struct section_descriptor {
+                    /// Offset in bytes from the beginning of the container, table included.
+                    std::size_t offset;
+                    /// Length in bytes.
+                    std::size_t size;
+                    /// Number of elements stored in the section.
+                    std::size_t count;
+                };
+
+                template<typename TTypeBase>
+                using section_table_entry = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // offset
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >,
+                            // size
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >,
+                            // count
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >
+                        >
+                    >;
+
+                /// @brief Table of contents of a container made of SectionsCount sections.
+                /// @details The table has a fixed length, so it can be read on its own
+                ///     and any section can be located without parsing the ones before it.
+                template<typename TTypeBase, 
+                         std::size_t SectionsCount>
+                using section_table = 
+                    nil::marshalling::types::array_list<
+                        TTypeBase,
+                        section_table_entry<TTypeBase>,
+                        nil::marshalling::option::sequence_fixed_size<
+                            SectionsCount
+                        > 
+                    >;
+
+                template<typename Endianness, 
+                         std::size_t SectionsCount>
+                constexpr std::size_t section_table_length() {
+                    return SectionsCount * 
+                        section_table_entry<
+                            nil::marshalling::field_type<
+                                Endianness>>::max_length();
+                }
+
+                /// @brief Build the table for sections laid out one after another
+                ///     right behind it.
+                /// @param[in] sizes_and_counts Length in bytes and number of elements
+                ///     of every section, in storage order.
+                template<typename Endianness, 
+                         std::size_t SectionsCount>
+                section_table<nil::marshalling::field_type<
+                        Endianness>, 
+                    SectionsCount>
+                    fill_section_table(
+                        const std::array<std::pair<std::size_t, std::size_t>, 
+                            SectionsCount> &sizes_and_counts){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using size_type = 
+                        nil::marshalling::types::integral<
+                            TTypeBase, 
+                            std::size_t
+                        >;
+
+                    section_table<TTypeBase, SectionsCount> filled_table;
+                    auto &filled_table_val = filled_table.value();
+                    filled_table_val.reserve(SectionsCount);
+
+                    std::size_t offset = section_table_length<Endianness, SectionsCount>();
+                    for (const std::pair<std::size_t, std::size_t> &size_and_count : sizes_and_counts) {
+                        filled_table_val.emplace_back(
+                            std::make_tuple(
+                                size_type(offset), 
+                                size_type(size_and_count.first), 
+                                size_type(size_and_count.second)));
+                        offset += size_and_count.first;
+                    }
+
+                    return filled_table;
+                }
+
+                template<typename Endianness, 
+                         std::size_t SectionsCount>
+                std::array<section_descriptor, SectionsCount>
+                    construct_section_table(
+                        const section_table<nil::marshalling::field_type<
+                                Endianness>, 
+                            SectionsCount> &filled_table){
+
+                    std::array<section_descriptor, SectionsCount> result;
+                    for (std::size_t i = 0; i < SectionsCount; i++) {
+                        const auto &entry = filled_table.value()[i].value();
+                        result[i] = section_descriptor{
+                            std::get<0>(entry).value(), 
+                            std::get<1>(entry).value(), 
+                            std::get<2>(entry).value()};
+                    }
+                    return result;
+                }
+
+                /// @brief Locate a section by reading only the table.
+                /// @param[in] iter Iterator to the beginning of the container.
+                /// @param[in] size Number of bytes available for reading.
+                /// @param[in] index Index of the section in storage order.
+                /// @param[out] status Status of read operation.
+                template<typename Endianness, 
+                         std::size_t SectionsCount, 
+                         typename TIter>
+                section_descriptor read_section_table_entry(
+                    TIter iter, 
+                    std::size_t size, 
+                    std::size_t index, 
+                    nil::marshalling::status_type &status){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    if (index >= SectionsCount) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return section_descriptor{0, 0, 0};
+                    }
+                    if (size < section_table_length<Endianness, SectionsCount>()) {
+                        status = nil::marshalling::status_type::not_enough_data;
+                        return section_descriptor{0, 0, 0};
+                    }
+
+                    const std::size_t entry_length = 
+                        section_table_entry<TTypeBase>::max_length();
+                    iter += index * entry_length;
+
+                    section_table_entry<TTypeBase> entry;
+                    status = entry.read(iter, entry_length);
+                    if (status != nil::marshalling::status_type::success) {
+                        return section_descriptor{0, 0, 0};
+                    }
+
+                    section_descriptor result{
+                        std::get<0>(entry.value()).value(), 
+                        std::get<1>(entry.value()).value(), 
+                        std::get<2>(entry.value()).value()};
+                    if (result.offset < section_table_length<Endianness, SectionsCount>() || 
+                        result.offset > size || result.size > size - result.offset) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return section_descriptor{0, 0, 0};
+                    }
+
+                    return result;
+                }
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_SECTION_TABLE_HPP
@@ -82,7 +82,7 @@ namespace nil {
                 accumulation_vector<nil::marshalling::field_type<
                                 Endianness>,
                                 AccumulationVector>
-                    fill_accumulation_vector(AccumulationVector accumulation_vector_inp){
+                    fill_accumulation_vector(const AccumulationVector &accumulation_vector_inp){
 
                     using TTypeBase = nil::marshalling::field_type<
                                 Endianness>;
@@ -111,12 +111,13 @@ namespace nil {
                           typename Endianness>
                 AccumulationVector
                     construct_accumulation_vector(
-                        accumulation_vector<nil::marshalling::field_type<
+                        const accumulation_vector<nil::marshalling::field_type<
                                 Endianness>,
-                                AccumulationVector> filled_accumulation_vector){
+                                AccumulationVector> &filled_accumulation_vector){
 
                     return AccumulationVector (
-                        std::move(std::get<0>(filled_accumulation_vector.value()).value()),
+                        typename AccumulationVector::group_type::value_type(
+                            std::get<0>(filled_accumulation_vector.value()).value()),
                         std::move(construct_sparse_vector<
                             zk::snark::sparse_vector<
                                 typename AccumulationVector::group_type>, 
@@ -125,6 +126,64 @@ namespace nil {
                             );
                 }
 
+                template <typename AccumulationVector, 
+                          typename Endianness>
+                std::size_t accumulation_vector_serialized_size(
+                    const AccumulationVector &accumulation_vector_inp){
+
+                    return curve_element_serialized_size<
+                            typename AccumulationVector::group_type, 
+                            Endianness>() + 
+                        sparse_vector_serialized_size<
+                            zk::snark::sparse_vector<
+                                typename AccumulationVector::group_type>, 
+                            Endianness>(accumulation_vector_inp.rest);
+                }
+
+                /// @brief Write the accumulation vector as the bundle produced by
+                ///     fill_accumulation_vector does, without constructing it.
+                /// @post The iterator is advanced.
+                template <typename AccumulationVector, 
+                          typename Endianness, 
+                          typename TIter>
+                void write_accumulation_vector_data(const AccumulationVector &accumulation_vector_inp, 
+                                                    TIter &iter){
+
+                    write_curve_element_data<
+                        typename AccumulationVector::group_type, 
+                        Endianness>(accumulation_vector_inp.first, iter);
+                    write_sparse_vector_data<
+                        zk::snark::sparse_vector<
+                            typename AccumulationVector::group_type>, 
+                        Endianness>(accumulation_vector_inp.rest, iter);
+                }
+
+                /// @brief Read an accumulation vector written by
+                ///     write_accumulation_vector_data straight into the native type.
+                template <typename AccumulationVector, 
+                          typename Endianness, 
+                          typename TIter>
+                AccumulationVector read_accumulation_vector_data(
+                    TIter &iter, 
+                    std::size_t &size, 
+                    nil::marshalling::status_type &status){
+
+                    typename AccumulationVector::group_type::value_type first = 
+                        read_curve_element_data<
+                            typename AccumulationVector::group_type, 
+                            Endianness>(iter, size, status);
+                    if (status != nil::marshalling::status_type::success) {
+                        return AccumulationVector();
+                    }
+
+                    return AccumulationVector(
+                        std::move(first), 
+                        read_sparse_vector_data<
+                            zk::snark::sparse_vector<
+                                typename AccumulationVector::group_type>, 
+                            Endianness>(iter, size, status));
+                }
+
             }    // namespace types
         }        // namespace marshalling
     }        // namespace crypto3
@@ -0,0 +1,612 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_ACCUMULATION_VECTOR_WINDOW_TABLES_HPP
+#define CRYPTO3_MARSHALLING_ACCUMULATION_VECTOR_WINDOW_TABLES_HPP
+
+#include <ratio>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include <iterator>
+
+#include <boost/assert.hpp>
+
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/types/tag.hpp>
+#include <nil/marshalling/types/detail/adapt_basic_field.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/zk/snark/accumulation_vector.hpp>
+
+#include <nil/crypto3/marshalling/types/algebra/field_element.hpp>
+#include <nil/crypto3/marshalling/types/algebra/curve_element.hpp>
+#include <nil/crypto3/marshalling/types/zk/accumulation_vector.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /// @brief Fixed-base window tables for every point in the sparse part
+                ///     of an accumulation vector.
+                /// @details tables[j][outer][inner] holds inner * 2^(outer * window) * rest.values[j],
+                ///     so multiplying rest.values[j] by a scalar of scalar_size bits takes
+                ///     one table lookup and one addition per window. Each table has
+                ///     ceil(scalar_size / window) rows of 2^window points, except the last
+                ///     one, which only covers the remaining scalar_size bits.
+                template<typename GroupType>
+                struct window_tables {
+                    using group_type = GroupType;
+                    using value_type = typename GroupType::value_type;
+                    using window_table_type = std::vector<std::vector<value_type>>;
+
+                    std::size_t scalar_size = 0;
+                    std::size_t window = 0;
+                    std::vector<window_table_type> tables;
+
+                    bool operator==(const window_tables &other) const {
+                        return scalar_size == other.scalar_size && 
+                               window == other.window && 
+                               tables == other.tables;
+                    }
+                };
+
+                namespace detail {
+                    inline bool window_parameters_are_valid(std::size_t scalar_size, 
+                                                            std::size_t window){
+                        return scalar_size > 0 && 
+                               window > 0 && 
+                               window < std::numeric_limits<std::size_t>::digits;
+                    }
+
+                    /// @pre window_parameters_are_valid(scalar_size, window)
+                    inline std::size_t window_table_rows_count(std::size_t scalar_size, 
+                                                               std::size_t window){
+                        return scalar_size / window + (scalar_size % window != 0);
+                    }
+
+                    /// @pre window_parameters_are_valid(scalar_size, window)
+                    inline std::size_t window_table_row_size(std::size_t scalar_size, 
+                                                             std::size_t window, 
+                                                             std::size_t outer){
+                        const std::size_t outerc = window_table_rows_count(scalar_size, window);
+                        return (outer == outerc - 1) ? 
+                            std::size_t(1) << (scalar_size - (outerc - 1) * window) : 
+                            std::size_t(1) << window;
+                    }
+
+                    /// @brief Check that table has exactly the shape make_window_table
+                    ///     builds for scalar_size and window, so that windowed_mul never
+                    ///     reads past the end of a row.
+                    template<typename WindowTable>
+                    bool window_table_shape_is_valid(const WindowTable &table, 
+                                                     std::size_t scalar_size, 
+                                                     std::size_t window){
+
+                        if (!window_parameters_are_valid(scalar_size, window) || 
+                            table.size() != window_table_rows_count(scalar_size, window)) {
+                            return false;
+                        }
+
+                        for (std::size_t outer = 0; 
+                             outer < table.size(); 
+                             outer++){
+                            if (table[outer].size() != 
+                                window_table_row_size(scalar_size, window, outer)) {
+                                return false;
+                            }
+                        }
+
+                        return true;
+                    }
+
+                    /// @pre window_parameters_are_valid(scalar_size, window)
+                    template<typename GroupType>
+                    typename window_tables<GroupType>::window_table_type
+                        make_window_table(std::size_t scalar_size, 
+                                          std::size_t window, 
+                                          const typename GroupType::value_type &g){
+
+                        using value_type = typename GroupType::value_type;
+
+                        BOOST_ASSERT(window_parameters_are_valid(scalar_size, window));
+
+                        const std::size_t outerc = window_table_rows_count(scalar_size, window);
+
+                        typename window_tables<GroupType>::window_table_type result(outerc);
+
+                        value_type gouter = g;
+
+                        for (std::size_t outer = 0; 
+                             outer < outerc; 
+                             outer++){
+                            value_type ginner = value_type::zero();
+                            std::size_t cur_in_window = 
+                                window_table_row_size(scalar_size, window, outer);
+                            result[outer].reserve(cur_in_window);
+                            for (std::size_t inner = 0; 
+                                 inner < cur_in_window; 
+                                 inner++){
+                                result[outer].push_back(ginner);
+                                ginner = ginner + gouter;
+                            }
+
+                            for (std::size_t i = 0; 
+                                 i < window; 
+                                 i++){
+                                gouter = gouter.doubled();
+                            }
+                        }
+
+                        return result;
+                    }
+
+                    /// @pre window_table_shape_is_valid(table, scalar_size, window) and
+                    ///     scalar has no bits set at or above scalar_size.
+                    template<typename GroupType, 
+                             typename Number>
+                    typename GroupType::value_type
+                        windowed_mul(const typename window_tables<GroupType>::window_table_type &table,
+                                     std::size_t scalar_size, 
+                                     std::size_t window, 
+                                     const Number &scalar){
+
+                        using value_type = typename GroupType::value_type;
+
+                        const std::size_t outerc = window_table_rows_count(scalar_size, window);
+
+                        value_type result = value_type::zero();
+
+                        for (std::size_t outer = 0; 
+                             outer < outerc; 
+                             outer++){
+                            std::size_t inner = 0;
+                            for (std::size_t i = 0; 
+                                 i < window && outer * window + i < scalar_size; 
+                                 i++){
+                                if (multiprecision::bit_test(scalar, outer * window + i)) {
+                                    inner |= std::size_t(1) << i;
+                                }
+                            }
+
+                            if (inner) {
+                                result = result + table[outer][inner];
+                            }
+                        }
+
+                        return result;
+                    }
+                }    // namespace detail
+
+                /// @brief Affine curve point stored as its uncompressed X and Y
+                ///     coordinates, so that loading it takes neither a square root nor
+                ///     an inversion. The point at infinity is stored as (0, 0), which is
+                ///     not an affine point of the supported curves.
+                template<typename TTypeBase, 
+                         typename CurveGroupType>
+                using affine_curve_element = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // X
+                            field_element<
+                                TTypeBase, 
+                                typename CurveGroupType::value_type::underlying_field_type
+                            >,
+                            // Y
+                            field_element<
+                                TTypeBase, 
+                                typename CurveGroupType::value_type::underlying_field_type
+                            >
+                        >
+                    >;
+
+                namespace detail {
+                    /// @pre point is the point at infinity or has Z == 1.
+                    template<typename CurveGroupType, 
+                             typename Endianness>
+                    affine_curve_element<nil::marshalling::field_type<
+                                Endianness>,
+                                CurveGroupType>
+                        fill_affine_curve_element(const typename CurveGroupType::value_type &point){
+
+                        using field_type = 
+                            typename CurveGroupType::value_type::underlying_field_type;
+
+                        if (point.is_zero()) {
+                            return affine_curve_element<nil::marshalling::field_type<
+                                Endianness>,
+                                CurveGroupType>(
+                                    std::make_tuple(
+                                        fill_field_element<field_type, Endianness>(
+                                            field_type::value_type::zero()),
+                                        fill_field_element<field_type, Endianness>(
+                                            field_type::value_type::zero())));
+                        }
+
+                        BOOST_ASSERT(point.Z == field_type::value_type::one());
+                        return affine_curve_element<nil::marshalling::field_type<
+                                Endianness>,
+                                CurveGroupType>(
+                                    std::make_tuple(
+                                        fill_field_element<field_type, Endianness>(point.X),
+                                        fill_field_element<field_type, Endianness>(point.Y)));
+                    }
+
+                    template<typename CurveGroupType, 
+                             typename Endianness>
+                    typename CurveGroupType::value_type
+                        construct_affine_curve_element(
+                            const affine_curve_element<nil::marshalling::field_type<
+                                Endianness>,
+                                CurveGroupType> &filled_point){
+
+                        using field_type = 
+                            typename CurveGroupType::value_type::underlying_field_type;
+
+                        const typename field_type::value_type X = 
+                            construct_field_element<field_type, Endianness>(
+                                std::get<0>(filled_point.value()));
+                        const typename field_type::value_type Y = 
+                            construct_field_element<field_type, Endianness>(
+                                std::get<1>(filled_point.value()));
+                        if (X == field_type::value_type::zero() && 
+                            Y == field_type::value_type::zero()) {
+                            return CurveGroupType::value_type::zero();
+                        }
+                        return typename CurveGroupType::value_type(X, Y, field_type::value_type::one());
+                    }
+                }    // namespace detail
+
+                template<typename TTypeBase, 
+                         typename AccumulationVector,
+                         typename = typename std::enable_if<
+                             std::is_same<AccumulationVector, 
+                                zk::snark::accumulation_vector<
+                                    typename AccumulationVector::group_type
+                                >
+                             >::value,
+                             bool>::type,
+                         typename... TOptions>
+                using accumulation_vector_window_tables = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // scalar_size
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >,
+                            // window
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >,
+                            // tables
+                            nil::marshalling::types::array_list<
+                                TTypeBase,
+                                nil::marshalling::types::array_list<
+                                    TTypeBase,
+                                    nil::marshalling::types::array_list<
+                                        TTypeBase,
+                                        affine_curve_element<
+                                            TTypeBase, 
+                                            typename AccumulationVector::group_type
+                                        >,
+                                        nil::marshalling::option::sequence_size_field_prefix<
+                                            nil::marshalling::types::integral<
+                                                TTypeBase, 
+                                                std::size_t
+                                            >
+                                        > 
+                                    >,
+                                    nil::marshalling::option::sequence_size_field_prefix<
+                                        nil::marshalling::types::integral<
+                                            TTypeBase, 
+                                            std::size_t
+                                        >
+                                    > 
+                                >,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        TTypeBase, 
+                                        std::size_t
+                                    >
+                                > 
+                            >
+                        >
+                    >;
+
+                /// @brief Precompute fixed-base window tables for every point of the
+                ///     sparse part of accumulation_vector_inp.
+                /// @param scalar_size Number of bits in the scalars the points will be
+                ///     multiplied by, non-zero. accumulate_with_window_tables only accepts
+                ///     tables covering every bit of the scalar field modulus.
+                /// @param window Window width in bits.
+                template <typename AccumulationVector>
+                window_tables<typename AccumulationVector::group_type>
+                    make_accumulation_vector_window_tables(
+                        const AccumulationVector &accumulation_vector_inp,
+                        std::size_t scalar_size, 
+                        std::size_t window){
+
+                    using group_type = typename AccumulationVector::group_type;
+
+                    BOOST_ASSERT(detail::window_parameters_are_valid(scalar_size, window));
+
+                    window_tables<group_type> result;
+                    result.scalar_size = scalar_size;
+                    result.window = window;
+                    result.tables.reserve(accumulation_vector_inp.rest.values.size());
+
+                    for (std::size_t i=0; 
+                         i<accumulation_vector_inp.rest.values.size();
+                         i++){
+                        result.tables.push_back(
+                            detail::make_window_table<group_type>(
+                                scalar_size, window, 
+                                accumulation_vector_inp.rest.values[i]));
+                    }
+
+                    return result;
+                }
+
+                /// @brief Accumulate a chunk [begin, end) of the primary input, starting at
+                ///     input index offset, into accumulation_vector_inp using precomputed
+                ///     window tables instead of a variable-base multiexponentiation.
+                /// @param[out] status invalid_msg_data if tables were not built for
+                ///     accumulation_vector_inp or do not cover every bit of the scalar
+                ///     field modulus, success otherwise.
+                /// @return first + sum of input[rest.indices[j]] * rest.values[j] over the
+                ///     indices in [offset, offset + (end - begin)), as accumulate_chunk does.
+                template <typename AccumulationVector,
+                          typename ScalarFieldType,
+                          typename InputIterator>
+                typename AccumulationVector::group_type::value_type
+                    accumulate_with_window_tables(
+                        const AccumulationVector &accumulation_vector_inp,
+                        const window_tables<typename AccumulationVector::group_type> &tables,
+                        InputIterator begin, 
+                        InputIterator end, 
+                        std::size_t offset, 
+                        nil::marshalling::status_type &status){
+
+                    using group_type = typename AccumulationVector::group_type;
+
+                    if (tables.tables.size() != accumulation_vector_inp.rest.values.size() || 
+                        tables.scalar_size < ScalarFieldType::modulus_bits) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return group_type::value_type::zero();
+                    }
+
+                    for (const auto &table : tables.tables){
+                        if (!detail::window_table_shape_is_valid(table, 
+                                tables.scalar_size, tables.window)) {
+                            status = nil::marshalling::status_type::invalid_msg_data;
+                            return group_type::value_type::zero();
+                        }
+                    }
+
+                    status = nil::marshalling::status_type::success;
+
+                    const std::size_t inputs_count = std::distance(begin, end);
+
+                    typename group_type::value_type result = accumulation_vector_inp.first;
+
+                    for (std::size_t j=0; 
+                         j<accumulation_vector_inp.rest.indices.size();
+                         j++){
+                        std::size_t index = accumulation_vector_inp.rest.indices[j];
+                        if (index < offset || index - offset >= inputs_count) {
+                            continue;
+                        }
+
+                        typename ScalarFieldType::modulus_type scalar = 
+                            typename ScalarFieldType::modulus_type(
+                                (*std::next(begin, index - offset)).data);
+
+                        result = result + 
+                            detail::windowed_mul<group_type>(
+                                tables.tables[j], 
+                                tables.scalar_size, 
+                                tables.window, 
+                                scalar);
+                    }
+
+                    return result;
+                }
+
+                template <typename AccumulationVector, 
+                          typename Endianness>
+                accumulation_vector_window_tables<nil::marshalling::field_type<
+                                Endianness>,
+                                AccumulationVector>
+                    fill_accumulation_vector_window_tables(
+                        const window_tables<typename AccumulationVector::group_type> &window_tables_inp){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using integral_type = 
+                        nil::marshalling::types::integral<
+                            TTypeBase,
+                            std::size_t
+                        >;
+
+                    using affine_point_type = 
+                        affine_curve_element<
+                            TTypeBase,
+                            typename AccumulationVector::group_type
+                        >;
+
+                    using window_row_type = 
+                        nil::marshalling::types::array_list<
+                            TTypeBase,
+                            affine_point_type,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                integral_type
+                            > 
+                        >;
+
+                    using window_table_type = 
+                        nil::marshalling::types::array_list<
+                            TTypeBase,
+                            window_row_type,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                integral_type
+                            > 
+                        >;
+
+                    using window_tables_type = 
+                        nil::marshalling::types::array_list<
+                            TTypeBase,
+                            window_table_type,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                integral_type
+                            > 
+                        >;
+
+                    window_tables_type filled_tables;
+
+                    std::vector<window_table_type> &filled_tables_val = filled_tables.value();
+                    filled_tables_val.reserve(window_tables_inp.tables.size());
+                    for (const auto &table : window_tables_inp.tables){
+                        window_table_type filled_table;
+                        std::vector<window_row_type> &filled_table_val = filled_table.value();
+                        filled_table_val.reserve(table.size());
+                        for (const auto &row : table){
+                            std::vector<typename AccumulationVector::group_type::value_type> 
+                                row_affine(row.size());
+                            detail::batch_to_affine(row.data(), row.size(), row_affine.data());
+
+                            window_row_type filled_row;
+                            std::vector<affine_point_type> &filled_row_val = filled_row.value();
+                            filled_row_val.reserve(row.size());
+                            for (const auto &point : row_affine){
+                                filled_row_val.push_back(
+                                    detail::fill_affine_curve_element<
+                                        typename AccumulationVector::group_type, 
+                                        Endianness>(point));
+                            }
+                            filled_table_val.push_back(std::move(filled_row));
+                        }
+                        filled_tables_val.push_back(std::move(filled_table));
+                    }
+
+                    return accumulation_vector_window_tables<nil::marshalling::field_type<
+                                Endianness>,
+                                AccumulationVector>(
+                                    std::make_tuple(
+                                        integral_type(window_tables_inp.scalar_size),
+                                        integral_type(window_tables_inp.window),
+                                        std::move(filled_tables)));
+                }
+
+                /// @param[out] status invalid_msg_data if the window parameters are out of
+                ///     range or some table does not have the shape make_window_table
+                ///     builds for them, success otherwise.
+                template <typename AccumulationVector, 
+                          typename Endianness>
+                window_tables<typename AccumulationVector::group_type>
+                    construct_accumulation_vector_window_tables(
+                        const accumulation_vector_window_tables<nil::marshalling::field_type<
+                                Endianness>,
+                                AccumulationVector> &filled_window_tables, 
+                        nil::marshalling::status_type &status){
+
+                    using group_type = typename AccumulationVector::group_type;
+
+                    window_tables<group_type> result;
+                    result.scalar_size = 
+                        std::get<0>(filled_window_tables.value()).value();
+                    result.window = 
+                        std::get<1>(filled_window_tables.value()).value();
+
+                    auto &filled_tables = 
+                        std::get<2>(filled_window_tables.value()).value();
+
+                    if (!detail::window_parameters_are_valid(result.scalar_size, result.window)) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return window_tables<group_type>();
+                    }
+
+                    const std::size_t outerc = 
+                        detail::window_table_rows_count(result.scalar_size, result.window);
+                    for (const auto &filled_table : filled_tables){
+                        bool shape_is_valid = (filled_table.value().size() == outerc);
+                        for (std::size_t outer=0; 
+                             shape_is_valid && outer<outerc;
+                             outer++){
+                            shape_is_valid = (filled_table.value()[outer].value().size() == 
+                                detail::window_table_row_size(
+                                    result.scalar_size, result.window, outer));
+                        }
+                        if (!shape_is_valid) {
+                            status = nil::marshalling::status_type::invalid_msg_data;
+                            return window_tables<group_type>();
+                        }
+                    }
+
+                    status = nil::marshalling::status_type::success;
+
+                    result.tables.resize(filled_tables.size());
+                    for (std::size_t i=0; 
+                         i<filled_tables.size();
+                         i++){
+                        auto &filled_table = filled_tables[i].value();
+                        result.tables[i].resize(filled_table.size());
+                        for (std::size_t outer=0; 
+                             outer<filled_table.size();
+                             outer++){
+                            auto &filled_row = filled_table[outer].value();
+                            result.tables[i][outer].reserve(filled_row.size());
+                            for (std::size_t inner=0; 
+                                 inner<filled_row.size();
+                                 inner++){
+                                result.tables[i][outer].push_back(
+                                    detail::construct_affine_curve_element<
+                                        group_type, 
+                                        Endianness>(filled_row[inner]));
+                            }
+                        }
+                    }
+
+                    return result;
+                }
+
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_ACCUMULATION_VECTOR_WINDOW_TABLES_HPP
@@ -0,0 +1,307 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_AUXILIARY_INPUT_HPP
+#define CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_AUXILIARY_INPUT_HPP
+
+#include <ratio>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include <cstdint>
+#include <iterator>
+
+#include <boost/assert.hpp>
+
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/types/tag.hpp>
+#include <nil/marshalling/types/detail/adapt_basic_field.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/zk/snark/relations/constraint_satisfaction_problems/r1cs.hpp>
+
+#include <nil/crypto3/marshalling/types/algebra/field_element.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                template<typename TTypeBase, 
+                         typename AuxiliaryInput,
+                         typename = typename std::enable_if<
+                             std::is_same<AuxiliaryInput, 
+                                zk::snark::r1cs_auxiliary_input<
+                                    typename AuxiliaryInput::value_type::field_type
+                                >
+                             >::value,
+                             bool>::type,
+                         typename... TOptions>
+                using r1cs_gg_ppzksnark_auxiliary_input = 
+                    nil::marshalling::types::array_list<
+                        TTypeBase,
+                        field_element<
+                            TTypeBase, 
+                            typename AuxiliaryInput::value_type::field_type
+                        >,
+                        nil::marshalling::option::sequence_size_field_prefix<
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >
+                        > 
+                    >;
+
+                template <typename AuxiliaryInput, 
+                          typename Endianness>
+                r1cs_gg_ppzksnark_auxiliary_input<nil::marshalling::field_type<
+                                Endianness>,
+                                AuxiliaryInput>
+                    fill_r1cs_gg_ppzksnark_auxiliary_input(const AuxiliaryInput &r1cs_gg_ppzksnark_auxiliary_input_inp){
+
+                    return fill_field_element_vector<typename AuxiliaryInput::value_type::field_type, 
+                                Endianness>(r1cs_gg_ppzksnark_auxiliary_input_inp);
+                }
+
+                template <typename AuxiliaryInput, 
+                          typename Endianness>
+                AuxiliaryInput
+                    construct_r1cs_gg_ppzksnark_auxiliary_input(
+                        const r1cs_gg_ppzksnark_auxiliary_input<nil::marshalling::field_type<
+                                Endianness>,
+                                AuxiliaryInput> &filled_r1cs_gg_ppzksnark_auxiliary_input){
+
+                    return construct_field_element_vector<typename AuxiliaryInput::value_type::field_type, 
+                        Endianness>(filled_r1cs_gg_ppzksnark_auxiliary_input);
+                }
+
+                template <typename AuxiliaryInput, 
+                          typename Endianness>
+                std::size_t r1cs_gg_ppzksnark_auxiliary_input_serialized_size(
+                    const AuxiliaryInput &r1cs_gg_ppzksnark_auxiliary_input_inp){
+
+                    return field_element_vector_serialized_size<
+                        typename AuxiliaryInput::value_type::field_type, 
+                        Endianness>(r1cs_gg_ppzksnark_auxiliary_input_inp);
+                }
+
+                namespace detail {
+                    template<typename FieldType, 
+                             typename Endianness>
+                    constexpr std::size_t auxiliary_input_element_length() {
+                        return field_element_serialized_size<FieldType, Endianness>();
+                    }
+
+                    /// @brief Pull exactly size bytes from the source.
+                    /// @return false if the source is exhausted first.
+                    template<typename Source>
+                    bool read_auxiliary_input_stream_bytes(Source &source, 
+                                                           std::uint8_t *data, 
+                                                           std::size_t size){
+                        while (size > 0) {
+                            const std::size_t read_size = source(data, size);
+                            if (read_size == 0) {
+                                return false;
+                            }
+                            data += read_size;
+                            size -= read_size;
+                        }
+                        return true;
+                    }
+                }    // namespace detail
+
+                /// @brief Write a witness as a stream of chunks.
+                /// @details Every chunk is encoded as r1cs_gg_ppzksnark_auxiliary_input holding
+                ///     at most chunk_size elements, and the stream is terminated by an empty
+                ///     chunk. Only one chunk is held in memory at a time: it is encoded into a
+                ///     reused buffer and handed to sink as sink(const std::uint8_t *data,
+                ///     std::size_t size), which returns a status. Writing stops at the first
+                ///     chunk the sink does not accept, and that status is returned.
+                template <typename FieldType, 
+                          typename Endianness, 
+                          typename InputIterator, 
+                          typename Sink>
+                nil::marshalling::status_type
+                    write_r1cs_gg_ppzksnark_auxiliary_input_stream(
+                        InputIterator first, 
+                        InputIterator last, 
+                        std::size_t chunk_size, 
+                        Sink &&sink){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using size_type = 
+                        nil::marshalling::types::integral<
+                            TTypeBase, 
+                            std::size_t
+                        >;
+
+                    BOOST_ASSERT(chunk_size > 0);
+
+                    const std::size_t element_length = 
+                        detail::auxiliary_input_element_length<FieldType, Endianness>();
+
+                    std::vector<std::uint8_t> buffer(size_type::max_length() + 
+                        chunk_size * element_length);
+
+                    nil::marshalling::status_type status = 
+                        nil::marshalling::status_type::success;
+
+                    bool finished = false;
+                    while (!finished) {
+                        auto write_iter = buffer.begin() + size_type::max_length();
+                        std::size_t count = 0;
+                        for (; count < chunk_size && first != last; ++count, ++first) {
+                            status = fill_field_element<FieldType, Endianness>(*first).write(
+                                write_iter, element_length);
+                            if (status != nil::marshalling::status_type::success) {
+                                return status;
+                            }
+                        }
+                        finished = (count == 0);
+
+                        auto prefix_iter = buffer.begin();
+                        status = size_type(count).write(prefix_iter, size_type::max_length());
+                        if (status != nil::marshalling::status_type::success) {
+                            return status;
+                        }
+
+                        status = sink(buffer.data(), size_type::max_length() + count * element_length);
+                        if (status != nil::marshalling::status_type::success) {
+                            return status;
+                        }
+                    }
+
+                    return status;
+                }
+
+                template <typename AuxiliaryInput, 
+                          typename Endianness, 
+                          typename Sink>
+                nil::marshalling::status_type
+                    write_r1cs_gg_ppzksnark_auxiliary_input_stream(
+                        const AuxiliaryInput &r1cs_gg_ppzksnark_auxiliary_input_inp, 
+                        std::size_t chunk_size, 
+                        Sink &&sink){
+
+                    return write_r1cs_gg_ppzksnark_auxiliary_input_stream<
+                        typename AuxiliaryInput::value_type::field_type, 
+                        Endianness>(r1cs_gg_ppzksnark_auxiliary_input_inp.begin(), 
+                                    r1cs_gg_ppzksnark_auxiliary_input_inp.end(), 
+                                    chunk_size, 
+                                    std::forward<Sink>(sink));
+                }
+
+                /// @brief Read a witness stream written by
+                ///     write_r1cs_gg_ppzksnark_auxiliary_input_stream.
+                /// @details Bytes are pulled from source as source(std::uint8_t *data,
+                ///     std::size_t size), which returns the number of bytes it stored, and
+                ///     zero once exhausted. Decoded elements are passed to out one chunk at
+                ///     a time. Chunks holding more than max_chunk_size elements are rejected,
+                ///     which bounds the memory used for buffering.
+                template <typename FieldType, 
+                          typename Endianness, 
+                          typename Source, 
+                          typename OutputIterator>
+                nil::marshalling::status_type
+                    read_r1cs_gg_ppzksnark_auxiliary_input_stream(
+                        Source &&source, 
+                        std::size_t max_chunk_size, 
+                        OutputIterator out){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using size_type = 
+                        nil::marshalling::types::integral<
+                            TTypeBase, 
+                            std::size_t
+                        >;
+
+                    using field_element_type = 
+                        field_element<
+                            TTypeBase, 
+                            FieldType
+                        >;
+
+                    const std::size_t element_length = 
+                        detail::auxiliary_input_element_length<FieldType, Endianness>();
+
+                    std::vector<std::uint8_t> buffer(size_type::max_length());
+
+                    nil::marshalling::status_type status = 
+                        nil::marshalling::status_type::success;
+
+                    while (true) {
+                        if (!detail::read_auxiliary_input_stream_bytes(source, 
+                                buffer.data(), size_type::max_length())) {
+                            return nil::marshalling::status_type::not_enough_data;
+                        }
+
+                        size_type count;
+                        auto read_iter = buffer.cbegin();
+                        status = count.read(read_iter, size_type::max_length());
+                        if (status != nil::marshalling::status_type::success) {
+                            return status;
+                        }
+
+                        if (count.value() == 0) {
+                            return status;
+                        }
+                        if (count.value() > max_chunk_size) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+
+                        buffer.resize(count.value() * element_length);
+                        if (!detail::read_auxiliary_input_stream_bytes(source, 
+                                buffer.data(), buffer.size())) {
+                            return nil::marshalling::status_type::not_enough_data;
+                        }
+
+                        read_iter = buffer.cbegin();
+                        for (std::size_t i = 0; i < count.value(); i++) {
+                            field_element_type filled_element;
+                            status = filled_element.read(read_iter, element_length);
+                            if (status != nil::marshalling::status_type::success) {
+                                return status;
+                            }
+                            *out++ = construct_field_element<FieldType, Endianness>(filled_element);
+                        }
+
+                        buffer.resize(size_type::max_length());
+                    }
+                }
+
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_AUXILIARY_INPUT_HPP
@@ -29,6 +29,9 @@
 #include <ratio>
 #include <limits>
 #include <type_traits>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
 
 #include <nil/marshalling/types/bundle.hpp>
 #include <nil/marshalling/types/array_list.hpp>
@@ -38,6 +41,8 @@
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/options.hpp>
 
+#include <boost/assert.hpp>
+
 #include <nil/crypto3/algebra/type_traits.hpp>
 
 #include <nil/crypto3/zk/snark/relations/constraint_satisfaction_problems/r1cs.hpp>
@@ -79,7 +84,7 @@ namespace nil {
                 r1cs_gg_ppzksnark_primary_input<nil::marshalling::field_type<
                                 Endianness>,
                                 PrimaryInput>
-                    fill_r1cs_gg_ppzksnark_primary_input(PrimaryInput r1cs_gg_ppzksnark_primary_input_inp){
+                    fill_r1cs_gg_ppzksnark_primary_input(const PrimaryInput &r1cs_gg_ppzksnark_primary_input_inp){
 
                     return fill_field_element_vector<typename PrimaryInput::value_type::field_type, 
                                 Endianness>(r1cs_gg_ppzksnark_primary_input_inp);
@@ -89,14 +94,396 @@ namespace nil {
                           typename Endianness>
                 PrimaryInput
                     construct_r1cs_gg_ppzksnark_primary_input(
-                        r1cs_gg_ppzksnark_primary_input<nil::marshalling::field_type<
+                        const r1cs_gg_ppzksnark_primary_input<nil::marshalling::field_type<
                                 Endianness>,
-                                PrimaryInput> filled_r1cs_gg_ppzksnark_primary_input){
+                                PrimaryInput> &filled_r1cs_gg_ppzksnark_primary_input){
 
                     return construct_field_element_vector<typename PrimaryInput::value_type::field_type, 
                         Endianness>(filled_r1cs_gg_ppzksnark_primary_input);
                 }
 
+                /// @brief Primary input with its boolean entries packed 8 per byte.
+                /// @details The bits plane holds the packed inputs in input order, packed
+                ///     input k at bit k % 8 of byte k / 8. Inputs which are not packed are
+                ///     stored as full field elements, also in input order. Which inputs are
+                ///     packed is told by the mask plane, one bit per input in the same bit
+                ///     order. The mask is left empty when it is implied: when the boolean
+                ///     inputs are declared by the circuit, or when every input is packed.
+                ///     Fully boolean inputs thus take one bit each. Unused padding bits of
+                ///     both planes are zero.
+                template<typename TTypeBase, 
+                         typename PrimaryInput,
+                         typename = typename std::enable_if<
+                             std::is_same<PrimaryInput, 
+                                zk::snark::r1cs_primary_input<
+                                    typename PrimaryInput::value_type::field_type
+                                >
+                             >::value,
+                             bool>::type,
+                         typename... TOptions>
+                using r1cs_gg_ppzksnark_packed_primary_input = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // inputs count
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >,
+                            // boolean inputs mask
+                            nil::marshalling::types::array_list<
+                                TTypeBase,
+                                nil::marshalling::types::integral<
+                                    TTypeBase, 
+                                    std::uint8_t
+                                >,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        TTypeBase, 
+                                        std::size_t
+                                    >
+                                > 
+                            >,
+                            // boolean inputs bits
+                            nil::marshalling::types::array_list<
+                                TTypeBase,
+                                nil::marshalling::types::integral<
+                                    TTypeBase, 
+                                    std::uint8_t
+                                >,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        TTypeBase, 
+                                        std::size_t
+                                    >
+                                > 
+                            >,
+                            // remaining inputs
+                            r1cs_gg_ppzksnark_primary_input<
+                                TTypeBase, 
+                                PrimaryInput
+                            >
+                        >
+                    >;
+
+                namespace detail {
+                    /// @brief Whether every bit of plane past the first bits_count is zero.
+                    template<typename Plane>
+                    bool packed_plane_padding_is_zero(const Plane &plane, 
+                                                      std::size_t bits_count) {
+                        for (std::size_t i = bits_count; i < plane.size() * 8; i++) {
+                            if ((plane[i / 8].value() >> (i % 8)) & 1) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
+                    template <typename PrimaryInput, 
+                              typename Endianness>
+                    r1cs_gg_ppzksnark_packed_primary_input<nil::marshalling::field_type<
+                                    Endianness>,
+                                    PrimaryInput>
+                        fill_packed_primary_input(
+                            const PrimaryInput &r1cs_gg_ppzksnark_primary_input_inp, 
+                            const std::vector<bool> &boolean_mask, 
+                            bool store_mask, 
+                            nil::marshalling::status_type &status){
+
+                        using TTypeBase = nil::marshalling::field_type<
+                                    Endianness>;
+                        using field_value_type = 
+                            typename PrimaryInput::value_type::field_type::value_type;
+                        using packed_primary_input_type = 
+                            r1cs_gg_ppzksnark_packed_primary_input<TTypeBase, 
+                                PrimaryInput>;
+
+                        using size_type = 
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >;
+                        using byte_type = 
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::uint8_t
+                            >;
+
+                        const std::size_t inputs_count = r1cs_gg_ppzksnark_primary_input_inp.size();
+                        if (boolean_mask.size() != inputs_count) {
+                            status = nil::marshalling::status_type::invalid_msg_data;
+                            return packed_primary_input_type();
+                        }
+
+                        const field_value_type zero = field_value_type::zero();
+                        const field_value_type one = field_value_type::one();
+
+                        std::vector<std::uint8_t> mask_bytes;
+                        std::vector<std::uint8_t> bits_bytes;
+                        std::size_t packed_count = 0;
+                        PrimaryInput remaining_inputs;
+
+                        if (store_mask) {
+                            mask_bytes.resize((inputs_count + 7) / 8, 0x00);
+                        }
+                        for (std::size_t i = 0; i < inputs_count; i++) {
+                            const field_value_type &input = r1cs_gg_ppzksnark_primary_input_inp[i];
+                            if (!boolean_mask[i]) {
+                                remaining_inputs.push_back(input);
+                                continue;
+                            }
+
+                            if (input != zero && input != one) {
+                                status = nil::marshalling::status_type::invalid_msg_data;
+                                return packed_primary_input_type();
+                            }
+                            if (store_mask) {
+                                mask_bytes[i / 8] |= std::uint8_t(1u << (i % 8));
+                            }
+                            if (packed_count % 8 == 0) {
+                                bits_bytes.push_back(0x00);
+                            }
+                            bits_bytes.back() |= std::uint8_t((input == one) << (packed_count % 8));
+                            packed_count++;
+                        }
+
+                        nil::marshalling::types::array_list<
+                            TTypeBase,
+                            byte_type,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                size_type
+                            > 
+                        > filled_mask, filled_bits;
+
+                        filled_mask.value().reserve(mask_bytes.size());
+                        for (std::uint8_t b : mask_bytes) {
+                            filled_mask.value().push_back(byte_type(b));
+                        }
+                        filled_bits.value().reserve(bits_bytes.size());
+                        for (std::uint8_t b : bits_bytes) {
+                            filled_bits.value().push_back(byte_type(b));
+                        }
+
+                        status = nil::marshalling::status_type::success;
+                        return packed_primary_input_type(
+                                        std::make_tuple(
+                                            size_type(inputs_count),
+                                            std::move(filled_mask),
+                                            std::move(filled_bits),
+                                            fill_r1cs_gg_ppzksnark_primary_input<
+                                                PrimaryInput, 
+                                                Endianness>(remaining_inputs)));
+                    }
+
+                    template <typename PrimaryInput, 
+                              typename Endianness>
+                    PrimaryInput
+                        construct_packed_primary_input(
+                            const r1cs_gg_ppzksnark_packed_primary_input<nil::marshalling::field_type<
+                                    Endianness>,
+                                    PrimaryInput> &filled_r1cs_gg_ppzksnark_packed_primary_input, 
+                            const std::vector<bool> &boolean_mask, 
+                            nil::marshalling::status_type &status){
+
+                        using field_type = typename PrimaryInput::value_type::field_type;
+                        using field_value_type = typename field_type::value_type;
+
+                        const std::size_t inputs_count = 
+                            std::get<0>(filled_r1cs_gg_ppzksnark_packed_primary_input.value()).value();
+                        const auto &filled_bits = 
+                            std::get<2>(filled_r1cs_gg_ppzksnark_packed_primary_input.value()).value();
+                        const auto &filled_remaining_inputs = 
+                            std::get<3>(filled_r1cs_gg_ppzksnark_packed_primary_input.value()).value();
+
+                        const std::size_t packed_count = 
+                            std::count(boolean_mask.begin(), boolean_mask.end(), true);
+                        if (boolean_mask.size() != inputs_count || 
+                            filled_bits.size() != (packed_count + 7) / 8 || 
+                            !packed_plane_padding_is_zero(filled_bits, packed_count) || 
+                            filled_remaining_inputs.size() != inputs_count - packed_count) {
+                            status = nil::marshalling::status_type::invalid_msg_data;
+                            return PrimaryInput();
+                        }
+
+                        const field_value_type bit_values[2] = {field_value_type::zero(), 
+                                                                field_value_type::one()};
+
+                        PrimaryInput result;
+                        result.reserve(inputs_count);
+                        std::size_t packed_index = 0;
+                        std::size_t remaining_index = 0;
+                        for (std::size_t i = 0; i < inputs_count; i++) {
+                            if (boolean_mask[i]) {
+                                result.push_back(bit_values[
+                                    (filled_bits[packed_index / 8].value() >> (packed_index % 8)) & 1]);
+                                packed_index++;
+                            } else {
+                                result.push_back(
+                                    construct_field_element<field_type, 
+                                        Endianness>(filled_remaining_inputs[remaining_index++]));
+                            }
+                        }
+
+                        status = nil::marshalling::status_type::success;
+                        return result;
+                    }
+                }    // namespace detail
+
+                /// @brief Pack the inputs the circuit declares boolean.
+                /// @details The mask is part of the circuit, so it is not stored, and
+                ///     construct_r1cs_gg_ppzksnark_packed_primary_input must be given the
+                ///     same mask.
+                /// @param[out] status invalid_msg_data if an input selected by
+                ///     boolean_mask is neither zero nor one, or the mask size differs from
+                ///     the inputs count.
+                template <typename PrimaryInput, 
+                          typename Endianness>
+                r1cs_gg_ppzksnark_packed_primary_input<nil::marshalling::field_type<
+                                Endianness>,
+                                PrimaryInput>
+                    fill_r1cs_gg_ppzksnark_packed_primary_input(
+                        const PrimaryInput &r1cs_gg_ppzksnark_primary_input_inp, 
+                        const std::vector<bool> &boolean_mask, 
+                        nil::marshalling::status_type &status){
+
+                    return detail::fill_packed_primary_input<PrimaryInput, Endianness>(
+                        r1cs_gg_ppzksnark_primary_input_inp, boolean_mask, false, status);
+                }
+
+                /// @brief Pack every input that is zero or one.
+                /// @details The mask is stored unless all inputs or none are packed.
+                template <typename PrimaryInput, 
+                          typename Endianness>
+                r1cs_gg_ppzksnark_packed_primary_input<nil::marshalling::field_type<
+                                Endianness>,
+                                PrimaryInput>
+                    fill_r1cs_gg_ppzksnark_packed_primary_input(
+                        const PrimaryInput &r1cs_gg_ppzksnark_primary_input_inp){
+
+                    using field_value_type = typename PrimaryInput::value_type::field_type::value_type;
+
+                    const field_value_type zero = field_value_type::zero();
+                    const field_value_type one = field_value_type::one();
+
+                    std::vector<bool> boolean_mask;
+                    boolean_mask.reserve(r1cs_gg_ppzksnark_primary_input_inp.size());
+                    for (const field_value_type &input : r1cs_gg_ppzksnark_primary_input_inp) {
+                        boolean_mask.push_back(input == zero || input == one);
+                    }
+                    const std::size_t packed_count = 
+                        std::count(boolean_mask.begin(), boolean_mask.end(), true);
+                    const bool store_mask = 
+                        packed_count != 0 && packed_count != boolean_mask.size();
+
+                    nil::marshalling::status_type status;
+                    auto result = detail::fill_packed_primary_input<PrimaryInput, Endianness>(
+                        r1cs_gg_ppzksnark_primary_input_inp, boolean_mask, store_mask, status);
+                    BOOST_ASSERT(status == nil::marshalling::status_type::success);
+                    return result;
+                }
+
+                /// @brief Unpack a primary input packed with a declared mask.
+                /// @param[out] status invalid_msg_data if the planes are inconsistent
+                ///     with boolean_mask and the inputs count.
+                template <typename PrimaryInput, 
+                          typename Endianness>
+                PrimaryInput
+                    construct_r1cs_gg_ppzksnark_packed_primary_input(
+                        const r1cs_gg_ppzksnark_packed_primary_input<nil::marshalling::field_type<
+                                Endianness>,
+                                PrimaryInput> &filled_r1cs_gg_ppzksnark_packed_primary_input, 
+                        const std::vector<bool> &boolean_mask, 
+                        nil::marshalling::status_type &status){
+
+                    if (!std::get<1>(filled_r1cs_gg_ppzksnark_packed_primary_input.value()).value().empty()) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return PrimaryInput();
+                    }
+
+                    return detail::construct_packed_primary_input<PrimaryInput, Endianness>(
+                        filled_r1cs_gg_ppzksnark_packed_primary_input, boolean_mask, status);
+                }
+
+                /// @brief Unpack a primary input packed without a declared mask.
+                /// @param[out] status invalid_msg_data if the planes are inconsistent
+                ///     with each other or with the inputs count, including set padding bits.
+                template <typename PrimaryInput, 
+                          typename Endianness>
+                PrimaryInput
+                    construct_r1cs_gg_ppzksnark_packed_primary_input(
+                        const r1cs_gg_ppzksnark_packed_primary_input<nil::marshalling::field_type<
+                                Endianness>,
+                                PrimaryInput> &filled_r1cs_gg_ppzksnark_packed_primary_input, 
+                        nil::marshalling::status_type &status){
+
+                    const std::size_t inputs_count = 
+                        std::get<0>(filled_r1cs_gg_ppzksnark_packed_primary_input.value()).value();
+                    const auto &filled_mask = 
+                        std::get<1>(filled_r1cs_gg_ppzksnark_packed_primary_input.value()).value();
+                    const auto &filled_bits = 
+                        std::get<2>(filled_r1cs_gg_ppzksnark_packed_primary_input.value()).value();
+
+                    if (filled_mask.empty()) {
+                        // no input or every input is packed
+                        return detail::construct_packed_primary_input<PrimaryInput, Endianness>(
+                            filled_r1cs_gg_ppzksnark_packed_primary_input, 
+                            std::vector<bool>(inputs_count, !filled_bits.empty()), status);
+                    }
+
+                    if (filled_mask.size() != (inputs_count + 7) / 8 || 
+                        !detail::packed_plane_padding_is_zero(filled_mask, inputs_count)) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return PrimaryInput();
+                    }
+
+                    std::vector<bool> boolean_mask(inputs_count);
+                    for (std::size_t i = 0; i < inputs_count; i++) {
+                        boolean_mask[i] = (filled_mask[i / 8].value() >> (i % 8)) & 1;
+                    }
+                    return detail::construct_packed_primary_input<PrimaryInput, Endianness>(
+                        filled_r1cs_gg_ppzksnark_packed_primary_input, boolean_mask, status);
+                }
+
+                template <typename PrimaryInput, 
+                          typename Endianness>
+                std::size_t r1cs_gg_ppzksnark_primary_input_serialized_size(
+                    const PrimaryInput &r1cs_gg_ppzksnark_primary_input_inp){
+
+                    return field_element_vector_serialized_size<
+                        typename PrimaryInput::value_type::field_type, 
+                        Endianness>(r1cs_gg_ppzksnark_primary_input_inp);
+                }
+
+                /// @brief Write the primary input as r1cs_gg_ppzksnark_primary_input does,
+                ///     without constructing it.
+                /// @post The iterator is advanced.
+                template <typename PrimaryInput, 
+                          typename Endianness, 
+                          typename TIter>
+                void write_r1cs_gg_ppzksnark_primary_input_data(
+                    const PrimaryInput &r1cs_gg_ppzksnark_primary_input_inp, 
+                    TIter &iter){
+
+                    write_field_element_vector_data<
+                        typename PrimaryInput::value_type::field_type, 
+                        Endianness>(r1cs_gg_ppzksnark_primary_input_inp, iter);
+                }
+
+                /// @brief Read a primary input written by
+                ///     write_r1cs_gg_ppzksnark_primary_input_data straight into the native type.
+                template <typename PrimaryInput, 
+                          typename Endianness, 
+                          typename TIter>
+                PrimaryInput read_r1cs_gg_ppzksnark_primary_input_data(
+                    TIter &iter, 
+                    std::size_t &size, 
+                    nil::marshalling::status_type &status){
+
+                    return read_field_element_vector_data<
+                        typename PrimaryInput::value_type::field_type, 
+                        Endianness>(iter, size, status);
+                }
+
             }    // namespace types
         }        // namespace marshalling
     }        // namespace crypto3
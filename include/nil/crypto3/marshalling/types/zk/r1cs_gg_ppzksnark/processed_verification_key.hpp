@@ -0,0 +1,223 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_PROCESSED_VERIFICATION_KEY_HPP
+#define CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_PROCESSED_VERIFICATION_KEY_HPP
+
+#include <ratio>
+#include <limits>
+#include <type_traits>
+
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/types/tag.hpp>
+#include <nil/marshalling/types/detail/adapt_basic_field.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/zk/snark/accumulation_vector.hpp>
+#include <nil/crypto3/zk/snark/schemes/ppzksnark/r1cs_gg_ppzksnark/verification_key.hpp>
+
+#include <nil/crypto3/marshalling/types/algebra/field_element.hpp>
+#include <nil/crypto3/marshalling/types/algebra/g2_precomp.hpp>
+#include <nil/crypto3/marshalling/types/zk/accumulation_vector.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                template<typename TTypeBase, 
+                         typename ProcessedVerificationKey,
+                         typename = typename std::enable_if<
+                             std::is_same<ProcessedVerificationKey, 
+                                zk::snark::r1cs_gg_ppzksnark_processed_verification_key<
+                                    typename ProcessedVerificationKey::curve_type
+                                >
+                             >::value,
+                             bool>::type,
+                         typename... TOptions>
+                using r1cs_gg_ppzksnark_processed_verification_key = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // vk_alpha_g1_beta_g2
+                            field_element<
+                                TTypeBase, 
+                                typename ProcessedVerificationKey::curve_type::gt_type
+                            >,
+                            // vk_gamma_g2_precomp
+                            g2_precomp<
+                                TTypeBase, 
+                                typename ProcessedVerificationKey::curve_type
+                            >,
+                            // vk_delta_g2_precomp
+                            g2_precomp<
+                                TTypeBase, 
+                                typename ProcessedVerificationKey::curve_type
+                            >,
+                            // gamma_ABC_g1
+                            accumulation_vector<
+                                TTypeBase, 
+                                zk::snark::accumulation_vector< 
+                                    typename ProcessedVerificationKey::curve_type::g1_type
+                                >
+                            >
+                        >
+                    >;
+
+                template <typename ProcessedVerificationKey, 
+                          typename Endianness>
+                r1cs_gg_ppzksnark_processed_verification_key<nil::marshalling::field_type<
+                                Endianness>,
+                                ProcessedVerificationKey>
+                    fill_r1cs_gg_ppzksnark_processed_verification_key(
+                        const ProcessedVerificationKey &r1cs_gg_ppzksnark_processed_verification_key_inp){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using curve_type = 
+                        typename ProcessedVerificationKey::curve_type;
+
+                    using field_gt_element_type = 
+                        field_element<
+                            TTypeBase,
+                            typename curve_type::gt_type
+                        >;
+
+                    using g2_precomp_type = 
+                        g2_precomp<
+                            TTypeBase,
+                            curve_type
+                        >;
+
+                    using accumulation_vector_type = 
+                        accumulation_vector<
+                            TTypeBase, 
+                            zk::snark::accumulation_vector< 
+                                typename curve_type::g1_type
+                            >
+                        >;
+
+                    field_gt_element_type filled_alpha_g1_beta_g2 = 
+                        fill_field_element<typename curve_type::gt_type, 
+                            Endianness> (r1cs_gg_ppzksnark_processed_verification_key_inp.vk_alpha_g1_beta_g2);
+
+                    g2_precomp_type filled_gamma_g2_precomp = 
+                        fill_g2_precomp<curve_type, 
+                            Endianness> (r1cs_gg_ppzksnark_processed_verification_key_inp.vk_gamma_g2_precomp);
+
+                    g2_precomp_type filled_delta_g2_precomp = 
+                        fill_g2_precomp<curve_type, 
+                            Endianness> (r1cs_gg_ppzksnark_processed_verification_key_inp.vk_delta_g2_precomp);
+
+                    accumulation_vector_type filled_gamma_ABC_g1 = 
+                        fill_accumulation_vector<
+                            zk::snark::accumulation_vector< 
+                                typename curve_type::g1_type
+                            >,
+                            Endianness> (r1cs_gg_ppzksnark_processed_verification_key_inp.gamma_ABC_g1);
+
+                    return r1cs_gg_ppzksnark_processed_verification_key<nil::marshalling::field_type<
+                                Endianness>,
+                                ProcessedVerificationKey>(
+                                    std::make_tuple(
+                                        std::move(filled_alpha_g1_beta_g2), 
+                                        std::move(filled_gamma_g2_precomp), 
+                                        std::move(filled_delta_g2_precomp), 
+                                        std::move(filled_gamma_ABC_g1)
+                                        ));
+                }
+
+                template <typename ProcessedVerificationKey, 
+                          typename Endianness>
+                ProcessedVerificationKey
+                    construct_r1cs_gg_ppzksnark_processed_verification_key(
+                        const r1cs_gg_ppzksnark_processed_verification_key<nil::marshalling::field_type<
+                                Endianness>,
+                                ProcessedVerificationKey> &filled_r1cs_gg_ppzksnark_processed_verification_key){
+
+                    using curve_type = 
+                        typename ProcessedVerificationKey::curve_type;
+
+                    ProcessedVerificationKey result;
+
+                    result.vk_alpha_g1_beta_g2 = 
+                        construct_field_element<
+                            typename curve_type::gt_type, 
+                            Endianness>(
+                                std::get<0>(filled_r1cs_gg_ppzksnark_processed_verification_key.value()));
+                    result.vk_gamma_g2_precomp = 
+                        construct_g2_precomp<
+                            curve_type, 
+                            Endianness>(
+                                std::get<1>(filled_r1cs_gg_ppzksnark_processed_verification_key.value()));
+                    result.vk_delta_g2_precomp = 
+                        construct_g2_precomp<
+                            curve_type, 
+                            Endianness>(
+                                std::get<2>(filled_r1cs_gg_ppzksnark_processed_verification_key.value()));
+                    result.gamma_ABC_g1 = 
+                        construct_accumulation_vector<
+                            zk::snark::accumulation_vector<
+                                typename curve_type::g1_type>, 
+                            Endianness>(
+                                std::get<3>(filled_r1cs_gg_ppzksnark_processed_verification_key.value()));
+
+                    return result;
+                }
+
+                template <typename ProcessedVerificationKey, 
+                          typename Endianness>
+                std::size_t r1cs_gg_ppzksnark_processed_verification_key_serialized_size(
+                    const ProcessedVerificationKey &r1cs_gg_ppzksnark_processed_verification_key_inp){
+
+                    using curve_type = 
+                        typename ProcessedVerificationKey::curve_type;
+
+                    return field_element_serialized_size<
+                            typename curve_type::gt_type, 
+                            Endianness>() + 
+                        g2_precomp_serialized_size<
+                            curve_type, 
+                            Endianness>(r1cs_gg_ppzksnark_processed_verification_key_inp.vk_gamma_g2_precomp) + 
+                        g2_precomp_serialized_size<
+                            curve_type, 
+                            Endianness>(r1cs_gg_ppzksnark_processed_verification_key_inp.vk_delta_g2_precomp) + 
+                        accumulation_vector_serialized_size<
+                            zk::snark::accumulation_vector<
+                                typename curve_type::g1_type>, 
+                            Endianness>(r1cs_gg_ppzksnark_processed_verification_key_inp.gamma_ABC_g1);
+                }
+
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_PROCESSED_VERIFICATION_KEY_HPP
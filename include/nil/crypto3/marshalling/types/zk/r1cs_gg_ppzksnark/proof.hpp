@@ -29,6 +29,8 @@
 #include <ratio>
 #include <limits>
 #include <type_traits>
+#include <array>
+#include <cstdint>
 
 #include <nil/marshalling/types/bundle.hpp>
 #include <nil/marshalling/types/array_list.hpp>
@@ -43,6 +45,7 @@
 #include <nil/crypto3/zk/snark/accumulation_vector.hpp>
 #include <nil/crypto3/zk/snark/schemes/ppzksnark/r1cs_gg_ppzksnark/proof.hpp>
 
+#include <nil/crypto3/marshalling/processing/curve_element.hpp>
 #include <nil/crypto3/marshalling/types/algebra/field_element.hpp>
 #include <nil/crypto3/marshalling/types/algebra/curve_element.hpp>
 #include <nil/crypto3/marshalling/types/zk/accumulation_vector.hpp>
@@ -89,7 +92,7 @@ namespace nil {
                 r1cs_gg_ppzksnark_proof<nil::marshalling::field_type<
                                 Endianness>,
                                 ProofType>
-                    fill_r1cs_gg_ppzksnark_proof(ProofType r1cs_gg_ppzksnark_proof_inp){
+                    fill_r1cs_gg_ppzksnark_proof(const ProofType &r1cs_gg_ppzksnark_proof_inp){
 
                     using TTypeBase = nil::marshalling::field_type<
                                 Endianness>;
@@ -120,14 +123,172 @@ namespace nil {
                           typename Endianness>
                 ProofType
                     construct_r1cs_gg_ppzksnark_proof(
-                        r1cs_gg_ppzksnark_proof<nil::marshalling::field_type<
+                        const r1cs_gg_ppzksnark_proof<nil::marshalling::field_type<
                                 Endianness>,
-                                ProofType> filled_r1cs_gg_ppzksnark_proof){
+                                ProofType> &filled_r1cs_gg_ppzksnark_proof){
 
                     return ProofType (
-                        std::move(std::get<0>(filled_r1cs_gg_ppzksnark_proof.value()).value()),
-                        std::move(std::get<1>(filled_r1cs_gg_ppzksnark_proof.value()).value()),
-                        std::move(std::get<2>(filled_r1cs_gg_ppzksnark_proof.value()).value())
+                        typename ProofType::curve_type::g1_type::value_type(
+                            std::get<0>(filled_r1cs_gg_ppzksnark_proof.value()).value()),
+                        typename ProofType::curve_type::g2_type::value_type(
+                            std::get<1>(filled_r1cs_gg_ppzksnark_proof.value()).value()),
+                        typename ProofType::curve_type::g1_type::value_type(
+                            std::get<2>(filled_r1cs_gg_ppzksnark_proof.value()).value())
+                        );
+                }
+
+                /// @brief Size in bytes of the compressed proof encoding.
+                template <typename ProofType, 
+                          typename Endianness>
+                constexpr std::size_t r1cs_gg_ppzksnark_proof_serialized_size() {
+                    return r1cs_gg_ppzksnark_proof<nil::marshalling::field_type<
+                                Endianness>,
+                                ProofType>::max_length();
+                }
+
+                /// @brief Write the proof as the bundle produced by
+                ///     fill_r1cs_gg_ppzksnark_proof does, without constructing it.
+                /// @pre At least
+                ///     r1cs_gg_ppzksnark_proof_serialized_size() units can be written, unless the
+                ///     iterator is an output iterator such as std::back_inserter.
+                /// @post The iterator is advanced.
+                template <typename ProofType, 
+                          typename Endianness, 
+                          typename TIter>
+                void write_r1cs_gg_ppzksnark_proof_data(
+                    const ProofType &r1cs_gg_ppzksnark_proof_inp, 
+                    TIter &iter){
+
+                    write_curve_element_data<
+                        typename ProofType::curve_type::g1_type, 
+                        Endianness>(r1cs_gg_ppzksnark_proof_inp.g_A, iter);
+                    write_curve_element_data<
+                        typename ProofType::curve_type::g2_type, 
+                        Endianness>(r1cs_gg_ppzksnark_proof_inp.g_B, iter);
+                    write_curve_element_data<
+                        typename ProofType::curve_type::g1_type, 
+                        Endianness>(r1cs_gg_ppzksnark_proof_inp.g_C, iter);
+                }
+
+                /// @brief Encode the proof straight into a fixed-size byte array.
+                /// @details Produces the same bytes as writing the result of
+                ///     fill_r1cs_gg_ppzksnark_proof, without building the intermediate
+                ///     bundle. No heap allocations are performed.
+                template <typename ProofType, 
+                          typename Endianness>
+                void write_r1cs_gg_ppzksnark_proof(
+                    const ProofType &r1cs_gg_ppzksnark_proof_inp, 
+                    std::array<std::uint8_t, 
+                        r1cs_gg_ppzksnark_proof_serialized_size<ProofType, Endianness>()> &out){
+
+                    auto iter = out.begin();
+                    write_r1cs_gg_ppzksnark_proof_data<
+                        ProofType, 
+                        Endianness>(r1cs_gg_ppzksnark_proof_inp, iter);
+                }
+
+                template <typename ProofType, 
+                          typename Endianness>
+                std::array<std::uint8_t, 
+                    r1cs_gg_ppzksnark_proof_serialized_size<ProofType, Endianness>()>
+                    write_r1cs_gg_ppzksnark_proof(
+                        const ProofType &r1cs_gg_ppzksnark_proof_inp){
+
+                    std::array<std::uint8_t, 
+                        r1cs_gg_ppzksnark_proof_serialized_size<ProofType, Endianness>()> out;
+                    write_r1cs_gg_ppzksnark_proof<ProofType, 
+                        Endianness>(r1cs_gg_ppzksnark_proof_inp, out);
+                    return out;
+                }
+
+                /// @brief Decode the proof straight from a fixed-size byte array.
+                template <typename ProofType, 
+                          typename Endianness>
+                ProofType
+                    read_r1cs_gg_ppzksnark_proof(
+                        const std::array<std::uint8_t, 
+                            r1cs_gg_ppzksnark_proof_serialized_size<ProofType, Endianness>()> &in){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+                    using endian_type = typename TTypeBase::endian_type;
+
+                    using g1_type = typename ProofType::curve_type::g1_type;
+                    using g2_type = typename ProofType::curve_type::g2_type;
+
+                    using curve_g1_element_type = 
+                        curve_element<
+                            TTypeBase,
+                            g1_type
+                        >;
+
+                    using curve_g2_element_type = 
+                        curve_element<
+                            TTypeBase,
+                            g2_type
+                        >;
+
+                    auto iter = in.begin();
+                    typename g1_type::value_type g_A = 
+                        processing::curve_element_read_data<
+                            curve_g1_element_type::bit_length(), 
+                            endian_type, 
+                            typename g1_type::value_type>(iter);
+                    iter += curve_g1_element_type::max_length();
+                    typename g2_type::value_type g_B = 
+                        processing::curve_element_read_data<
+                            curve_g2_element_type::bit_length(), 
+                            endian_type, 
+                            typename g2_type::value_type>(iter);
+                    iter += curve_g2_element_type::max_length();
+                    typename g1_type::value_type g_C = 
+                        processing::curve_element_read_data<
+                            curve_g1_element_type::bit_length(), 
+                            endian_type, 
+                            typename g1_type::value_type>(iter);
+
+                    return ProofType (
+                        std::move(g_A),
+                        std::move(g_B),
+                        std::move(g_C)
+                        );
+                }
+
+                /// @brief Read a proof written by write_r1cs_gg_ppzksnark_proof_data
+                ///     straight into the native type.
+                /// @param[in, out] iter Iterator to read the data, advanced on success.
+                /// @param[in, out] size Number of bytes available for reading, decreased on success.
+                /// @param[out] status Status of read operation.
+                template <typename ProofType, 
+                          typename Endianness, 
+                          typename TIter>
+                ProofType read_r1cs_gg_ppzksnark_proof_data(
+                    TIter &iter, 
+                    std::size_t &size, 
+                    nil::marshalling::status_type &status){
+
+                    if (size < r1cs_gg_ppzksnark_proof_serialized_size<ProofType, Endianness>()) {
+                        status = nil::marshalling::status_type::not_enough_data;
+                        return ProofType();
+                    }
+
+                    typename ProofType::curve_type::g1_type::value_type g_A = 
+                        read_curve_element_data<
+                            typename ProofType::curve_type::g1_type, 
+                            Endianness>(iter, size, status);
+                    typename ProofType::curve_type::g2_type::value_type g_B = 
+                        read_curve_element_data<
+                            typename ProofType::curve_type::g2_type, 
+                            Endianness>(iter, size, status);
+                    typename ProofType::curve_type::g1_type::value_type g_C = 
+                        read_curve_element_data<
+                            typename ProofType::curve_type::g1_type, 
+                            Endianness>(iter, size, status);
+
+                    return ProofType (
+                        std::move(g_A),
+                        std::move(g_B),
+                        std::move(g_C)
                         );
                 }
 
@@ -0,0 +1,483 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_PROOF_BATCH_HPP
+#define CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_PROOF_BATCH_HPP
+
+#include <ratio>
+#include <limits>
+#include <type_traits>
+#include <array>
+#include <future>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/types/tag.hpp>
+#include <nil/marshalling/types/detail/adapt_basic_field.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/zk/snark/relations/constraint_satisfaction_problems/r1cs.hpp>
+#include <nil/crypto3/zk/snark/schemes/ppzksnark/r1cs_gg_ppzksnark/proof.hpp>
+
+#include <nil/crypto3/marshalling/processing/curve_element.hpp>
+#include <nil/crypto3/marshalling/types/algebra/curve_element.hpp>
+#include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/proof.hpp>
+#include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/primary_input.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /// @brief Batch of proofs laid out as structure of arrays: all g_A points,
+                ///     then all g_B points, then all g_C points, then the primary inputs,
+                ///     in the order the batched pairing check consumes them.
+                template<typename ProofType>
+                struct r1cs_gg_ppzksnark_proof_batch_planes {
+                    using curve_type = typename ProofType::curve_type;
+                    using primary_input_type =
+                        zk::snark::r1cs_primary_input<typename curve_type::scalar_field_type>;
+
+                    std::vector<typename curve_type::g1_type::value_type> g_A;
+                    std::vector<typename curve_type::g2_type::value_type> g_B;
+                    std::vector<typename curve_type::g1_type::value_type> g_C;
+                    std::vector<primary_input_type> primary_inputs;
+
+                    std::size_t size() const {
+                        return g_A.size();
+                    }
+
+                    ProofType proof(std::size_t i) const {
+                        return ProofType(
+                            typename curve_type::g1_type::value_type(g_A[i]),
+                            typename curve_type::g2_type::value_type(g_B[i]),
+                            typename curve_type::g1_type::value_type(g_C[i]));
+                    }
+                };
+
+                template<typename TTypeBase,
+                         typename ProofType,
+                         typename = typename std::enable_if<
+                             std::is_same<ProofType,
+                                zk::snark::r1cs_gg_ppzksnark_proof<
+                                    typename ProofType::curve_type
+                                >
+                             >::value,
+                             bool>::type,
+                         typename... TOptions>
+                using r1cs_gg_ppzksnark_proof_batch =
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // g_A plane
+                            nil::marshalling::types::array_list<
+                                TTypeBase,
+                                curve_element<
+                                    TTypeBase,
+                                    typename ProofType::curve_type::g1_type
+                                >,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        TTypeBase,
+                                        std::size_t
+                                    >
+                                >
+                            >,
+                            // g_B plane
+                            nil::marshalling::types::array_list<
+                                TTypeBase,
+                                curve_element<
+                                    TTypeBase,
+                                    typename ProofType::curve_type::g2_type
+                                >,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        TTypeBase,
+                                        std::size_t
+                                    >
+                                >
+                            >,
+                            // g_C plane
+                            nil::marshalling::types::array_list<
+                                TTypeBase,
+                                curve_element<
+                                    TTypeBase,
+                                    typename ProofType::curve_type::g1_type
+                                >,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        TTypeBase,
+                                        std::size_t
+                                    >
+                                >
+                            >,
+                            // primary inputs plane
+                            nil::marshalling::types::array_list<
+                                TTypeBase,
+                                r1cs_gg_ppzksnark_primary_input<
+                                    TTypeBase,
+                                    zk::snark::r1cs_primary_input<
+                                        typename ProofType::curve_type::scalar_field_type
+                                    >
+                                >,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        TTypeBase,
+                                        std::size_t
+                                    >
+                                >
+                            >
+                        >
+                    >;
+
+                template <typename ProofType,
+                          typename Endianness>
+                r1cs_gg_ppzksnark_proof_batch<nil::marshalling::field_type<
+                                Endianness>,
+                                ProofType>
+                    fill_r1cs_gg_ppzksnark_proof_batch(
+                        const r1cs_gg_ppzksnark_proof_batch_planes<ProofType> &r1cs_gg_ppzksnark_proof_batch_inp){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using curve_type = typename ProofType::curve_type;
+                    using primary_input_type =
+                        typename r1cs_gg_ppzksnark_proof_batch_planes<ProofType>::primary_input_type;
+
+                    using primary_input_vector_type =
+                        nil::marshalling::types::array_list<
+                            TTypeBase,
+                            r1cs_gg_ppzksnark_primary_input<
+                                TTypeBase,
+                                primary_input_type
+                            >,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                nil::marshalling::types::integral<
+                                    TTypeBase,
+                                    std::size_t
+                                >
+                            >
+                        >;
+
+                    BOOST_ASSERT(r1cs_gg_ppzksnark_proof_batch_inp.g_B.size() ==
+                        r1cs_gg_ppzksnark_proof_batch_inp.size());
+                    BOOST_ASSERT(r1cs_gg_ppzksnark_proof_batch_inp.g_C.size() ==
+                        r1cs_gg_ppzksnark_proof_batch_inp.size());
+                    BOOST_ASSERT(r1cs_gg_ppzksnark_proof_batch_inp.primary_inputs.size() ==
+                        r1cs_gg_ppzksnark_proof_batch_inp.size());
+
+                    primary_input_vector_type filled_primary_inputs;
+                    auto &filled_primary_inputs_val = filled_primary_inputs.value();
+                    filled_primary_inputs_val.reserve(r1cs_gg_ppzksnark_proof_batch_inp.primary_inputs.size());
+                    for (const auto &primary_input : r1cs_gg_ppzksnark_proof_batch_inp.primary_inputs){
+                        filled_primary_inputs_val.push_back(
+                            fill_r1cs_gg_ppzksnark_primary_input<
+                                primary_input_type,
+                                Endianness>(primary_input));
+                    }
+
+                    return r1cs_gg_ppzksnark_proof_batch<nil::marshalling::field_type<
+                                Endianness>,
+                                ProofType>(
+                                    std::make_tuple(
+                                        fill_curve_element_vector<
+                                            typename curve_type::g1_type,
+                                            Endianness>(r1cs_gg_ppzksnark_proof_batch_inp.g_A),
+                                        fill_curve_element_vector<
+                                            typename curve_type::g2_type,
+                                            Endianness>(r1cs_gg_ppzksnark_proof_batch_inp.g_B),
+                                        fill_curve_element_vector<
+                                            typename curve_type::g1_type,
+                                            Endianness>(r1cs_gg_ppzksnark_proof_batch_inp.g_C),
+                                        std::move(filled_primary_inputs)));
+                }
+
+                template <typename ProofType,
+                          typename Endianness>
+                r1cs_gg_ppzksnark_proof_batch<nil::marshalling::field_type<
+                                Endianness>,
+                                ProofType>
+                    fill_r1cs_gg_ppzksnark_proof_batch(
+                        const std::vector<ProofType> &proofs,
+                        const std::vector<typename r1cs_gg_ppzksnark_proof_batch_planes<
+                            ProofType>::primary_input_type> &primary_inputs){
+
+                    BOOST_ASSERT(proofs.size() == primary_inputs.size());
+
+                    r1cs_gg_ppzksnark_proof_batch_planes<ProofType> planes;
+                    planes.g_A.reserve(proofs.size());
+                    planes.g_B.reserve(proofs.size());
+                    planes.g_C.reserve(proofs.size());
+                    for (const ProofType &proof : proofs){
+                        planes.g_A.push_back(proof.g_A);
+                        planes.g_B.push_back(proof.g_B);
+                        planes.g_C.push_back(proof.g_C);
+                    }
+                    planes.primary_inputs = primary_inputs;
+
+                    return fill_r1cs_gg_ppzksnark_proof_batch<ProofType,
+                        Endianness>(planes);
+                }
+
+                template <typename ProofType,
+                          typename Endianness>
+                r1cs_gg_ppzksnark_proof_batch_planes<ProofType>
+                    construct_r1cs_gg_ppzksnark_proof_batch(
+                        const r1cs_gg_ppzksnark_proof_batch<nil::marshalling::field_type<
+                                Endianness>,
+                                ProofType> &filled_r1cs_gg_ppzksnark_proof_batch){
+
+                    using curve_type = typename ProofType::curve_type;
+                    using primary_input_type =
+                        typename r1cs_gg_ppzksnark_proof_batch_planes<ProofType>::primary_input_type;
+
+                    r1cs_gg_ppzksnark_proof_batch_planes<ProofType> result;
+
+                    result.g_A = construct_curve_element_vector<
+                        typename curve_type::g1_type,
+                        Endianness>(std::get<0>(filled_r1cs_gg_ppzksnark_proof_batch.value()));
+                    result.g_B = construct_curve_element_vector<
+                        typename curve_type::g2_type,
+                        Endianness>(std::get<1>(filled_r1cs_gg_ppzksnark_proof_batch.value()));
+                    result.g_C = construct_curve_element_vector<
+                        typename curve_type::g1_type,
+                        Endianness>(std::get<2>(filled_r1cs_gg_ppzksnark_proof_batch.value()));
+
+                    auto &filled_primary_inputs =
+                        std::get<3>(filled_r1cs_gg_ppzksnark_proof_batch.value()).value();
+                    result.primary_inputs.reserve(filled_primary_inputs.size());
+                    for (std::size_t i=0;
+                         i<filled_primary_inputs.size();
+                         i++){
+                        result.primary_inputs.push_back(
+                            construct_r1cs_gg_ppzksnark_primary_input<
+                                primary_input_type,
+                                Endianness>(filled_primary_inputs[i]));
+                    }
+
+                    return result;
+                }
+
+                namespace detail {
+                    template<typename GroupType,
+                             typename Endianness,
+                             typename TIter>
+                    void read_curve_element_plane(TIter iter,
+                                                  std::vector<typename GroupType::value_type> &plane){
+
+                        using TTypeBase = nil::marshalling::field_type<
+                                    Endianness>;
+                        using curve_element_type =
+                            curve_element<
+                                TTypeBase,
+                                GroupType
+                            >;
+
+                        for (std::size_t i=0;
+                             i<plane.size();
+                             i++){
+                            plane[i] = processing::curve_element_read_data<
+                                curve_element_type::bit_length(),
+                                typename TTypeBase::endian_type,
+                                typename GroupType::value_type>(iter);
+                            iter += curve_element_type::max_length();
+                        }
+                    }
+
+                    template<typename Endianness,
+                             typename TIter>
+                    std::size_t read_plane_size(TIter &iter,
+                                                std::size_t &size,
+                                                nil::marshalling::status_type &status){
+
+                        using size_type =
+                            nil::marshalling::types::integral<
+                                nil::marshalling::field_type<
+                                    Endianness>,
+                                std::size_t
+                            >;
+
+                        size_type plane_size;
+                        if (size < size_type::max_length()) {
+                            status = nil::marshalling::status_type::not_enough_data;
+                            return 0;
+                        }
+                        status = plane_size.read(iter, size);
+                        size -= size_type::max_length();
+                        return plane_size.value();
+                    }
+                }    // namespace detail
+
+                /// @brief Decode a batch straight into its planes.
+                /// @details The planes hold fixed-size elements, so the offset of every plane
+                ///     is known once its size prefix is read. Point decompression of the
+                ///     g_A, g_B and g_C planes then runs concurrently, while the primary
+                ///     inputs are decoded on the calling thread.
+                /// @param[in] iter Random access iterator to the serialized batch.
+                /// @param[in] size Number of bytes available for reading.
+                /// @param[out] status Status of read operation.
+                template <typename ProofType,
+                          typename Endianness,
+                          typename TIter>
+                r1cs_gg_ppzksnark_proof_batch_planes<ProofType>
+                    read_r1cs_gg_ppzksnark_proof_batch(TIter iter,
+                                                       std::size_t size,
+                                                       nil::marshalling::status_type &status){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using curve_type = typename ProofType::curve_type;
+                    using g1_element_type = curve_element<TTypeBase, typename curve_type::g1_type>;
+                    using g2_element_type = curve_element<TTypeBase, typename curve_type::g2_type>;
+
+                    using primary_input_type =
+                        typename r1cs_gg_ppzksnark_proof_batch_planes<ProofType>::primary_input_type;
+                    using primary_input_vector_type =
+                        nil::marshalling::types::array_list<
+                            TTypeBase,
+                            r1cs_gg_ppzksnark_primary_input<
+                                TTypeBase,
+                                primary_input_type
+                            >,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                nil::marshalling::types::integral<
+                                    TTypeBase,
+                                    std::size_t
+                                >
+                            >
+                        >;
+
+                    r1cs_gg_ppzksnark_proof_batch_planes<ProofType> result;
+
+                    std::array<TIter, 3> plane_iters;
+                    std::array<std::size_t, 3> plane_sizes;
+                    std::array<std::size_t, 3> element_lengths = {
+                        g1_element_type::max_length(),
+                        g2_element_type::max_length(),
+                        g1_element_type::max_length()};
+
+                    for (std::size_t i = 0; i < 3; i++) {
+                        plane_sizes[i] = detail::read_plane_size<Endianness>(iter, size, status);
+                        if (status != nil::marshalling::status_type::success) {
+                            return result;
+                        }
+                        if (plane_sizes[i] != plane_sizes[0]) {
+                            status = nil::marshalling::status_type::invalid_msg_data;
+                            return result;
+                        }
+                        if (size / element_lengths[i] < plane_sizes[i]) {
+                            status = nil::marshalling::status_type::not_enough_data;
+                            return result;
+                        }
+                        plane_iters[i] = iter;
+                        iter += plane_sizes[i] * element_lengths[i];
+                        size -= plane_sizes[i] * element_lengths[i];
+                    }
+
+                    result.g_A.resize(plane_sizes[0]);
+                    result.g_B.resize(plane_sizes[1]);
+                    result.g_C.resize(plane_sizes[2]);
+
+                    std::future<void> g_A_decoded = std::async(std::launch::async,
+                        detail::read_curve_element_plane<typename curve_type::g1_type, Endianness, TIter>,
+                        plane_iters[0], std::ref(result.g_A));
+                    std::future<void> g_B_decoded = std::async(std::launch::async,
+                        detail::read_curve_element_plane<typename curve_type::g2_type, Endianness, TIter>,
+                        plane_iters[1], std::ref(result.g_B));
+                    detail::read_curve_element_plane<typename curve_type::g1_type, Endianness>(
+                        plane_iters[2], result.g_C);
+
+                    primary_input_vector_type filled_primary_inputs;
+                    status = filled_primary_inputs.read(iter, size);
+
+                    g_A_decoded.get();
+                    g_B_decoded.get();
+
+                    if (status != nil::marshalling::status_type::success) {
+                        return result;
+                    }
+                    if (filled_primary_inputs.value().size() != plane_sizes[0]) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return result;
+                    }
+
+                    result.primary_inputs.reserve(plane_sizes[0]);
+                    for (std::size_t i=0;
+                         i<plane_sizes[0];
+                         i++){
+                        result.primary_inputs.push_back(
+                            construct_r1cs_gg_ppzksnark_primary_input<
+                                primary_input_type,
+                                Endianness>(filled_primary_inputs.value()[i]));
+                    }
+
+                    return result;
+                }
+
+                template <typename ProofType,
+                          typename Endianness>
+                std::size_t r1cs_gg_ppzksnark_proof_batch_serialized_size(
+                    const r1cs_gg_ppzksnark_proof_batch_planes<ProofType> &r1cs_gg_ppzksnark_proof_batch_inp){
+
+                    using curve_type = typename ProofType::curve_type;
+                    using primary_input_type =
+                        typename r1cs_gg_ppzksnark_proof_batch_planes<ProofType>::primary_input_type;
+
+                    std::size_t result = 
+                        curve_element_vector_serialized_size<
+                            typename curve_type::g1_type,
+                            Endianness>(r1cs_gg_ppzksnark_proof_batch_inp.g_A) + 
+                        curve_element_vector_serialized_size<
+                            typename curve_type::g2_type,
+                            Endianness>(r1cs_gg_ppzksnark_proof_batch_inp.g_B) + 
+                        curve_element_vector_serialized_size<
+                            typename curve_type::g1_type,
+                            Endianness>(r1cs_gg_ppzksnark_proof_batch_inp.g_C) + 
+                        nil::marshalling::types::integral<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            std::size_t>::max_length();
+                    for (const primary_input_type &primary_input : r1cs_gg_ppzksnark_proof_batch_inp.primary_inputs){
+                        result += r1cs_gg_ppzksnark_primary_input_serialized_size<
+                            primary_input_type,
+                            Endianness>(primary_input);
+                    }
+                    return result;
+                }
+
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_PROOF_BATCH_HPP
@@ -0,0 +1,500 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_PROVING_KEY_HPP
+#define CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_PROVING_KEY_HPP
+
+#include <ratio>
+#include <limits>
+#include <type_traits>
+#include <array>
+#include <tuple>
+#include <vector>
+#include <utility>
+
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/types/tag.hpp>
+#include <nil/marshalling/types/detail/adapt_basic_field.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/zk/snark/schemes/ppzksnark/r1cs_gg_ppzksnark/proving_key.hpp>
+
+#include <nil/crypto3/marshalling/types/algebra/curve_element.hpp>
+#include <nil/crypto3/marshalling/types/section_table.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /// @brief Sections of the proving key, in the order they are stored.
+                enum class r1cs_gg_ppzksnark_proving_key_section : std::size_t {
+                    /// alpha_g1, beta_g1, beta_g2, delta_g1, delta_g2
+                    fixed = 0,
+                    A_query = 1,
+                    B_query = 2,
+                    H_query = 3,
+                    L_query = 4
+                };
+
+                constexpr static const std::size_t r1cs_gg_ppzksnark_proving_key_sections_count = 5;
+
+                template<typename TTypeBase, 
+                         typename GroupType>
+                using r1cs_gg_ppzksnark_proving_key_query = 
+                    nil::marshalling::types::array_list<
+                        TTypeBase,
+                        curve_element<
+                            TTypeBase, 
+                            GroupType
+                        >,
+                        nil::marshalling::option::sequence_size_field_prefix<
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >
+                        > 
+                    >;
+
+                template<typename TTypeBase, 
+                         typename ProvingKey>
+                using r1cs_gg_ppzksnark_proving_key_fixed = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // alpha_g1
+                            curve_element<
+                                TTypeBase, 
+                                typename ProvingKey::curve_type::g1_type
+                            >,
+                            // beta_g1
+                            curve_element<
+                                TTypeBase, 
+                                typename ProvingKey::curve_type::g1_type
+                            >,
+                            // beta_g2
+                            curve_element<
+                                TTypeBase, 
+                                typename ProvingKey::curve_type::g2_type
+                            >,
+                            // delta_g1
+                            curve_element<
+                                TTypeBase, 
+                                typename ProvingKey::curve_type::g1_type
+                            >,
+                            // delta_g2
+                            curve_element<
+                                TTypeBase, 
+                                typename ProvingKey::curve_type::g2_type
+                            >
+                        >
+                    >;
+
+                /// @brief B_query knowledge commitment vector, with the G2 and G1 parts
+                ///     of the commitments stored as two separate vectors.
+                template<typename TTypeBase, 
+                         typename ProvingKey>
+                using r1cs_gg_ppzksnark_proving_key_b_query = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // indices
+                            nil::marshalling::types::array_list<
+                                TTypeBase,
+                                nil::marshalling::types::integral<
+                                    TTypeBase, 
+                                    std::size_t
+                                >,
+                                nil::marshalling::option::sequence_size_field_prefix<
+                                    nil::marshalling::types::integral<
+                                        TTypeBase, 
+                                        std::size_t
+                                    >
+                                > 
+                            >,
+                            // g
+                            r1cs_gg_ppzksnark_proving_key_query<
+                                TTypeBase, 
+                                typename ProvingKey::curve_type::g2_type
+                            >,
+                            // h
+                            r1cs_gg_ppzksnark_proving_key_query<
+                                TTypeBase, 
+                                typename ProvingKey::curve_type::g1_type
+                            >,
+                            // domain_size_
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >
+                        >
+                    >;
+
+                /// @brief Sectioned proving key. The constraint system is not stored.
+                template<typename TTypeBase, 
+                         typename ProvingKey>
+                using r1cs_gg_ppzksnark_proving_key = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // table of contents
+                            section_table<
+                                TTypeBase, 
+                                r1cs_gg_ppzksnark_proving_key_sections_count
+                            >,
+                            // fixed
+                            r1cs_gg_ppzksnark_proving_key_fixed<
+                                TTypeBase, 
+                                ProvingKey
+                            >,
+                            // A_query
+                            r1cs_gg_ppzksnark_proving_key_query<
+                                TTypeBase, 
+                                typename ProvingKey::curve_type::g1_type
+                            >,
+                            // B_query
+                            r1cs_gg_ppzksnark_proving_key_b_query<
+                                TTypeBase, 
+                                ProvingKey
+                            >,
+                            // H_query
+                            r1cs_gg_ppzksnark_proving_key_query<
+                                TTypeBase, 
+                                typename ProvingKey::curve_type::g1_type
+                            >,
+                            // L_query
+                            r1cs_gg_ppzksnark_proving_key_query<
+                                TTypeBase, 
+                                typename ProvingKey::curve_type::g1_type
+                            >
+                        >
+                    >;
+
+                template <typename ProvingKey, 
+                          typename Endianness>
+                r1cs_gg_ppzksnark_proving_key<nil::marshalling::field_type<
+                                Endianness>,
+                                ProvingKey>
+                    fill_r1cs_gg_ppzksnark_proving_key(const ProvingKey &r1cs_gg_ppzksnark_proving_key_inp){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using g1_type = typename ProvingKey::curve_type::g1_type;
+                    using g2_type = typename ProvingKey::curve_type::g2_type;
+
+                    using curve_g1_element_type = 
+                        curve_element<
+                            TTypeBase,
+                            g1_type
+                        >;
+                    using curve_g2_element_type = 
+                        curve_element<
+                            TTypeBase,
+                            g2_type
+                        >;
+                    using size_type = 
+                        nil::marshalling::types::integral<
+                            TTypeBase, 
+                            std::size_t
+                        >;
+                    using b_query_type = 
+                        r1cs_gg_ppzksnark_proving_key_b_query<
+                            TTypeBase, 
+                            ProvingKey
+                        >;
+
+                    const ProvingKey &pk = r1cs_gg_ppzksnark_proving_key_inp;
+
+                    r1cs_gg_ppzksnark_proving_key_fixed<TTypeBase, ProvingKey> filled_fixed(
+                        std::make_tuple(
+                            curve_g1_element_type(pk.alpha_g1),
+                            curve_g1_element_type(pk.beta_g1),
+                            curve_g2_element_type(pk.beta_g2),
+                            curve_g1_element_type(pk.delta_g1),
+                            curve_g2_element_type(pk.delta_g2)));
+
+                    auto filled_A_query = 
+                        fill_curve_element_vector<g1_type, Endianness>(pk.A_query);
+
+                    typename std::tuple_element<0, typename b_query_type::value_type>::type 
+                        filled_B_query_indices;
+                    filled_B_query_indices.value().reserve(pk.B_query.indices.size());
+                    for (std::size_t index : pk.B_query.indices) {
+                        filled_B_query_indices.value().push_back(size_type(index));
+                    }
+                    r1cs_gg_ppzksnark_proving_key_query<TTypeBase, g2_type> filled_B_query_g;
+                    r1cs_gg_ppzksnark_proving_key_query<TTypeBase, g1_type> filled_B_query_h;
+                    filled_B_query_g.value().reserve(pk.B_query.values.size());
+                    filled_B_query_h.value().reserve(pk.B_query.values.size());
+                    for (const auto &commitment : pk.B_query.values) {
+                        filled_B_query_g.value().push_back(curve_g2_element_type(commitment.g));
+                        filled_B_query_h.value().push_back(curve_g1_element_type(commitment.h));
+                    }
+                    b_query_type filled_B_query(
+                        std::make_tuple(
+                            std::move(filled_B_query_indices),
+                            std::move(filled_B_query_g),
+                            std::move(filled_B_query_h),
+                            size_type(pk.B_query.domain_size_)));
+
+                    auto filled_H_query = 
+                        fill_curve_element_vector<g1_type, Endianness>(pk.H_query);
+                    auto filled_L_query = 
+                        fill_curve_element_vector<g1_type, Endianness>(pk.L_query);
+
+                    auto filled_table = 
+                        fill_section_table<Endianness, r1cs_gg_ppzksnark_proving_key_sections_count>({{
+                            {filled_fixed.length(), 5},
+                            {filled_A_query.length(), pk.A_query.size()},
+                            {filled_B_query.length(), pk.B_query.values.size()},
+                            {filled_H_query.length(), pk.H_query.size()},
+                            {filled_L_query.length(), pk.L_query.size()}}});
+
+                    return r1cs_gg_ppzksnark_proving_key<TTypeBase,
+                                ProvingKey>(
+                                    std::make_tuple(
+                                        std::move(filled_table),
+                                        std::move(filled_fixed),
+                                        std::move(filled_A_query),
+                                        std::move(filled_B_query),
+                                        std::move(filled_H_query),
+                                        std::move(filled_L_query)));
+                }
+
+                /// @param[out] status invalid_msg_data if the index, G2 and G1 counts differ.
+                template <typename ProvingKey, 
+                          typename Endianness>
+                decltype(ProvingKey::B_query)
+                    construct_r1cs_gg_ppzksnark_proving_key_b_query(
+                        const r1cs_gg_ppzksnark_proving_key_b_query<nil::marshalling::field_type<
+                                Endianness>,
+                                ProvingKey> &filled_b_query, 
+                        nil::marshalling::status_type &status){
+
+                    using g1_type = typename ProvingKey::curve_type::g1_type;
+                    using g2_type = typename ProvingKey::curve_type::g2_type;
+
+                    const auto &filled_indices = std::get<0>(filled_b_query.value()).value();
+                    const auto &filled_g = std::get<1>(filled_b_query.value()).value();
+                    const auto &filled_h = std::get<2>(filled_b_query.value()).value();
+
+                    decltype(ProvingKey::B_query) result;
+                    if (filled_g.size() != filled_indices.size() || 
+                        filled_h.size() != filled_indices.size()) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return result;
+                    }
+
+                    result.indices.reserve(filled_indices.size());
+                    for (const auto &index : filled_indices) {
+                        result.indices.push_back(index.value());
+                    }
+                    result.values.reserve(filled_g.size());
+                    for (std::size_t i = 0; i < filled_g.size(); i++) {
+                        result.values.emplace_back(
+                            typename g2_type::value_type(filled_g[i].value()), 
+                            typename g1_type::value_type(filled_h[i].value()));
+                    }
+                    result.domain_size_ = std::get<3>(filled_b_query.value()).value();
+                    status = nil::marshalling::status_type::success;
+
+                    return result;
+                }
+
+                /// @brief Rebuild the proving key from its sections.
+                /// @param[in] constraint_system Constraint system of the key, which is
+                ///     not part of the marshalled form.
+                /// @param[out] status invalid_msg_data if the B_query counts differ, in
+                ///     which case the returned key has an empty B_query.
+                template <typename ProvingKey, 
+                          typename Endianness>
+                ProvingKey construct_r1cs_gg_ppzksnark_proving_key(
+                    const r1cs_gg_ppzksnark_proving_key<nil::marshalling::field_type<
+                            Endianness>,
+                            ProvingKey> &filled_r1cs_gg_ppzksnark_proving_key, 
+                    typename ProvingKey::constraint_system_type constraint_system, 
+                    nil::marshalling::status_type &status){
+
+                    using g1_type = typename ProvingKey::curve_type::g1_type;
+                    using g2_type = typename ProvingKey::curve_type::g2_type;
+
+                    const auto &filled_fixed = 
+                        std::get<1>(filled_r1cs_gg_ppzksnark_proving_key.value()).value();
+
+                    decltype(ProvingKey::B_query) B_query = 
+                        construct_r1cs_gg_ppzksnark_proving_key_b_query<ProvingKey, Endianness>(
+                            std::get<3>(filled_r1cs_gg_ppzksnark_proving_key.value()), status);
+
+                    return ProvingKey(
+                        typename g1_type::value_type(std::get<0>(filled_fixed).value()),
+                        typename g1_type::value_type(std::get<1>(filled_fixed).value()),
+                        typename g2_type::value_type(std::get<2>(filled_fixed).value()),
+                        typename g1_type::value_type(std::get<3>(filled_fixed).value()),
+                        typename g2_type::value_type(std::get<4>(filled_fixed).value()),
+                        construct_curve_element_vector<g1_type, Endianness>(
+                            std::get<2>(filled_r1cs_gg_ppzksnark_proving_key.value())),
+                        std::move(B_query),
+                        construct_curve_element_vector<g1_type, Endianness>(
+                            std::get<4>(filled_r1cs_gg_ppzksnark_proving_key.value())),
+                        construct_curve_element_vector<g1_type, Endianness>(
+                            std::get<5>(filled_r1cs_gg_ppzksnark_proving_key.value())),
+                        std::move(constraint_system));
+                }
+
+                template <typename ProvingKey, 
+                          typename Endianness>
+                std::size_t r1cs_gg_ppzksnark_proving_key_serialized_size(
+                    const ProvingKey &r1cs_gg_ppzksnark_proving_key_inp){
+
+                    using g1_type = typename ProvingKey::curve_type::g1_type;
+                    using g2_type = typename ProvingKey::curve_type::g2_type;
+
+                    constexpr static const std::size_t size_length = 
+                        nil::marshalling::types::integral<
+                            nil::marshalling::field_type<
+                                Endianness>, 
+                            std::size_t>::max_length();
+
+                    const ProvingKey &pk = r1cs_gg_ppzksnark_proving_key_inp;
+
+                    return section_table_length<Endianness, r1cs_gg_ppzksnark_proving_key_sections_count>() + 
+                        3 * curve_element_serialized_size<g1_type, Endianness>() + 
+                        2 * curve_element_serialized_size<g2_type, Endianness>() + 
+                        curve_element_vector_serialized_size<g1_type, Endianness>(pk.A_query) + 
+                        (1 + pk.B_query.indices.size()) * size_length + 
+                        pk.B_query.values.size() * (
+                            curve_element_serialized_size<g2_type, Endianness>() + 
+                            curve_element_serialized_size<g1_type, Endianness>()) + 
+                        3 * size_length + 
+                        curve_element_vector_serialized_size<g1_type, Endianness>(pk.H_query) + 
+                        curve_element_vector_serialized_size<g1_type, Endianness>(pk.L_query);
+                }
+
+                /// @brief Locate a section of a serialized proving key by reading only
+                ///     its table of contents.
+                template <typename Endianness, 
+                          typename TIter>
+                section_descriptor read_r1cs_gg_ppzksnark_proving_key_section(
+                    TIter iter, 
+                    std::size_t size, 
+                    r1cs_gg_ppzksnark_proving_key_section section, 
+                    nil::marshalling::status_type &status){
+
+                    return read_section_table_entry<
+                        Endianness, 
+                        r1cs_gg_ppzksnark_proving_key_sections_count>(
+                            iter, size, static_cast<std::size_t>(section), status);
+                }
+
+                /// @brief Decode a single G1 query vector of a serialized proving key.
+                /// @details Only the table of contents and the requested section are
+                ///     read, so different sections can be decoded independently and
+                ///     concurrently from the same buffer.
+                /// @param[in] iter Iterator to the beginning of the proving key.
+                /// @param[in] size Number of bytes available for reading.
+                /// @param[in] section One of A_query, H_query or L_query.
+                /// @param[out] status Status of read operation.
+                template <typename ProvingKey, 
+                          typename Endianness, 
+                          typename TIter>
+                std::vector<typename ProvingKey::curve_type::g1_type::value_type>
+                    read_r1cs_gg_ppzksnark_proving_key_query(
+                        TIter iter, 
+                        std::size_t size, 
+                        r1cs_gg_ppzksnark_proving_key_section section, 
+                        nil::marshalling::status_type &status){
+
+                    if (section != r1cs_gg_ppzksnark_proving_key_section::A_query && 
+                        section != r1cs_gg_ppzksnark_proving_key_section::H_query && 
+                        section != r1cs_gg_ppzksnark_proving_key_section::L_query) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return {};
+                    }
+
+                    const section_descriptor descriptor = 
+                        read_r1cs_gg_ppzksnark_proving_key_section<Endianness>(
+                            iter, size, section, status);
+                    if (status != nil::marshalling::status_type::success) {
+                        return {};
+                    }
+
+                    iter += descriptor.offset;
+                    std::size_t section_size = descriptor.size;
+                    std::vector<typename ProvingKey::curve_type::g1_type::value_type> result = 
+                        read_curve_element_vector_data<
+                            typename ProvingKey::curve_type::g1_type, 
+                            Endianness>(iter, section_size, status);
+                    if (status == nil::marshalling::status_type::success && 
+                        (result.size() != descriptor.count || section_size != 0)) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                    }
+                    return result;
+                }
+
+                /// @brief Decode the B_query section of a serialized proving key.
+                template <typename ProvingKey, 
+                          typename Endianness, 
+                          typename TIter>
+                decltype(ProvingKey::B_query)
+                    read_r1cs_gg_ppzksnark_proving_key_b_query(
+                        TIter iter, 
+                        std::size_t size, 
+                        nil::marshalling::status_type &status){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    const section_descriptor descriptor = 
+                        read_r1cs_gg_ppzksnark_proving_key_section<Endianness>(
+                            iter, size, r1cs_gg_ppzksnark_proving_key_section::B_query, status);
+                    if (status != nil::marshalling::status_type::success) {
+                        return {};
+                    }
+
+                    iter += descriptor.offset;
+                    r1cs_gg_ppzksnark_proving_key_b_query<TTypeBase, ProvingKey> filled_b_query;
+                    status = filled_b_query.read(iter, descriptor.size);
+                    if (status != nil::marshalling::status_type::success) {
+                        return {};
+                    }
+                    if (std::get<1>(filled_b_query.value()).value().size() != descriptor.count) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return {};
+                    }
+
+                    return construct_r1cs_gg_ppzksnark_proving_key_b_query<ProvingKey, Endianness>(
+                        filled_b_query, status);
+                }
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_PROVING_KEY_HPP
@@ -0,0 +1,447 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_PROVING_KEY_IMAGE_HPP
+#define CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_PROVING_KEY_IMAGE_HPP
+
+#include <array>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/marshalling/types/algebra/curve_element_planes.hpp>
+#include <nil/crypto3/marshalling/io/mapped_file.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /// @brief Sections of a proving key image, in file order.
+                enum class r1cs_gg_ppzksnark_proving_key_image_section : std::size_t {
+                    /// alpha_g1, beta_g1, delta_g1
+                    g1_fixed,
+                    /// beta_g2, delta_g2
+                    g2_fixed,
+                    A_query,
+                    /// 64-bit indices of the B_query sparse vector
+                    B_query_indices,
+                    /// G1 parts of the B_query knowledge commitments
+                    B_query_g1,
+                    /// G2 parts of the B_query knowledge commitments
+                    B_query_g2,
+                    H_query,
+                    L_query
+                };
+
+                /// @brief Fixed 64-byte header at the start of a proving key image.
+                /// @details All fields are in host byte order. byte_order holds
+                ///     0x0102030405060708 as written by the producing host, so that an
+                ///     image is never read on a host with a different limb order.
+                struct r1cs_gg_ppzksnark_proving_key_image_header {
+                    std::uint64_t magic;
+                    std::uint64_t byte_order;
+                    std::uint32_t version;
+                    std::uint32_t limb_bits;
+                    std::uint32_t g1_point_limbs;
+                    std::uint32_t g2_point_limbs;
+                    /// Bytes following the header, including the section table.
+                    std::uint64_t payload_size;
+                    /// FNV-1a of the payload.
+                    std::uint64_t checksum;
+                    std::uint64_t B_query_domain_size;
+                    std::uint32_t sections_count;
+                    std::uint32_t reserved;
+                };
+
+                struct r1cs_gg_ppzksnark_proving_key_image_section_entry {
+                    /// Byte offset from the start of the image, a multiple of 64.
+                    std::uint64_t offset;
+                    /// Number of points or indices in the section.
+                    std::uint64_t count;
+                };
+
+                namespace detail {
+                    /// Reads "C3PKIMG1" as the first bytes of an image from a little-endian host.
+                    constexpr static const std::uint64_t proving_key_image_magic = 
+                        0x31474D494B503343;
+                    constexpr static const std::uint64_t proving_key_image_byte_order = 
+                        0x0102030405060708;
+                    constexpr static const std::uint32_t proving_key_image_version = 1;
+                    constexpr static const std::size_t proving_key_image_alignment = 64;
+                    constexpr static const std::size_t proving_key_image_sections_count = 8;
+
+                    static_assert(sizeof(r1cs_gg_ppzksnark_proving_key_image_header) == 
+                        proving_key_image_alignment, 
+                        "Proving key image header must take exactly one block");
+                    static_assert((proving_key_image_sections_count * 
+                        sizeof(r1cs_gg_ppzksnark_proving_key_image_section_entry)) % 
+                            proving_key_image_alignment == 0, 
+                        "Proving key image section table must end on a block boundary");
+
+                    inline std::uint64_t proving_key_image_checksum(const std::uint8_t *first, 
+                                                                    const std::uint8_t *last) {
+                        std::uint64_t result = 0xcbf29ce484222325;
+                        for (; first != last; ++first) {
+                            result ^= *first;
+                            result *= 0x100000001b3;
+                        }
+                        return result;
+                    }
+
+                    constexpr std::size_t proving_key_image_align(std::size_t offset) {
+                        return (offset + proving_key_image_alignment - 1) / 
+                            proving_key_image_alignment * proving_key_image_alignment;
+                    }
+
+                    template<typename ProvingKey>
+                    std::array<r1cs_gg_ppzksnark_proving_key_image_section_entry, 
+                        proving_key_image_sections_count> 
+                        proving_key_image_sections(const ProvingKey &pk) {
+
+                        using g1_layout = 
+                            affine_point_layout<typename ProvingKey::curve_type::g1_type>;
+                        using g2_layout = 
+                            affine_point_layout<typename ProvingKey::curve_type::g2_type>;
+
+                        const std::array<std::pair<std::size_t, std::size_t>, 
+                            proving_key_image_sections_count> counts_and_sizes = {{
+                            {3, g1_layout::point_size},
+                            {2, g2_layout::point_size},
+                            {pk.A_query.size(), g1_layout::point_size},
+                            {pk.B_query.indices.size(), sizeof(std::uint64_t)},
+                            {pk.B_query.values.size(), g1_layout::point_size},
+                            {pk.B_query.values.size(), g2_layout::point_size},
+                            {pk.H_query.size(), g1_layout::point_size},
+                            {pk.L_query.size(), g1_layout::point_size}}};
+
+                        std::array<r1cs_gg_ppzksnark_proving_key_image_section_entry, 
+                            proving_key_image_sections_count> result;
+                        std::size_t offset = sizeof(r1cs_gg_ppzksnark_proving_key_image_header) + 
+                            sizeof(result);
+                        for (std::size_t i = 0; i < proving_key_image_sections_count; i++) {
+                            result[i].offset = offset;
+                            result[i].count = counts_and_sizes[i].first;
+                            offset = proving_key_image_align(
+                                offset + counts_and_sizes[i].first * counts_and_sizes[i].second);
+                        }
+                        return result;
+                    }
+                }    // namespace detail
+
+                template<typename ProvingKey>
+                std::size_t r1cs_gg_ppzksnark_proving_key_image_size(const ProvingKey &pk) {
+                    // L_query is the last section
+                    const auto sections = detail::proving_key_image_sections(pk);
+                    return detail::proving_key_image_align(
+                        sections.back().offset + 
+                        sections.back().count * 
+                            affine_point_layout<typename ProvingKey::curve_type::g1_type>::point_size);
+                }
+
+                /// @brief Write the MSM-ready image of a proving key.
+                /// @details Every point is converted to affine form once, here, so that
+                ///     loading the image needs no per-point work. The constraint system
+                ///     is not part of the image.
+                /// @pre out points to r1cs_gg_ppzksnark_proving_key_image_size(pk) bytes,
+                ///     aligned for 64-bit access.
+                template<typename ProvingKey>
+                void write_r1cs_gg_ppzksnark_proving_key_image(const ProvingKey &pk, 
+                                                               std::uint8_t *out) {
+                    using g1_type = typename ProvingKey::curve_type::g1_type;
+                    using g2_type = typename ProvingKey::curve_type::g2_type;
+                    using g1_layout = affine_point_layout<g1_type>;
+                    using g2_layout = affine_point_layout<g2_type>;
+                    using limb_type = typename g1_layout::limb_type;
+                    using section_type = r1cs_gg_ppzksnark_proving_key_image_section;
+
+                    const std::size_t image_size = r1cs_gg_ppzksnark_proving_key_image_size(pk);
+                    const auto sections = detail::proving_key_image_sections(pk);
+                    std::memset(out, 0, image_size);
+
+                    auto section_limbs = [&](section_type section) {
+                        return reinterpret_cast<limb_type *>(
+                            out + sections[static_cast<std::size_t>(section)].offset);
+                    };
+                    auto write_g1_points = [&](section_type section, 
+                                               const std::vector<typename g1_type::value_type> &points) {
+                        limb_type *limbs = section_limbs(section);
+                        for (std::size_t i = 0; i < points.size(); i++) {
+                            g1_layout::write(points[i], limbs + i * g1_layout::point_limbs);
+                        }
+                    };
+
+                    write_g1_points(section_type::g1_fixed, {pk.alpha_g1, pk.beta_g1, pk.delta_g1});
+                    g2_layout::write(pk.beta_g2, section_limbs(section_type::g2_fixed));
+                    g2_layout::write(pk.delta_g2, 
+                        section_limbs(section_type::g2_fixed) + g2_layout::point_limbs);
+                    write_g1_points(section_type::A_query, pk.A_query);
+
+                    std::uint64_t *indices = reinterpret_cast<std::uint64_t *>(
+                        section_limbs(section_type::B_query_indices));
+                    for (std::size_t i = 0; i < pk.B_query.indices.size(); i++) {
+                        indices[i] = pk.B_query.indices[i];
+                    }
+                    limb_type *B_query_g1 = section_limbs(section_type::B_query_g1);
+                    limb_type *B_query_g2 = section_limbs(section_type::B_query_g2);
+                    for (std::size_t i = 0; i < pk.B_query.values.size(); i++) {
+                        g1_layout::write(pk.B_query.values[i].h, B_query_g1 + i * g1_layout::point_limbs);
+                        g2_layout::write(pk.B_query.values[i].g, B_query_g2 + i * g2_layout::point_limbs);
+                    }
+
+                    write_g1_points(section_type::H_query, pk.H_query);
+                    write_g1_points(section_type::L_query, pk.L_query);
+
+                    std::memcpy(out + sizeof(r1cs_gg_ppzksnark_proving_key_image_header), 
+                                sections.data(), sizeof(sections));
+
+                    r1cs_gg_ppzksnark_proving_key_image_header header;
+                    header.magic = detail::proving_key_image_magic;
+                    header.byte_order = detail::proving_key_image_byte_order;
+                    header.version = detail::proving_key_image_version;
+                    header.limb_bits = g1_layout::limb_bits;
+                    header.g1_point_limbs = g1_layout::point_limbs;
+                    header.g2_point_limbs = g2_layout::point_limbs;
+                    header.payload_size = image_size - sizeof(header);
+                    header.checksum = detail::proving_key_image_checksum(
+                        out + sizeof(header), out + image_size);
+                    header.B_query_domain_size = pk.B_query.domain_size_;
+                    header.sections_count = detail::proving_key_image_sections_count;
+                    header.reserved = 0;
+                    std::memcpy(out, &header, sizeof(header));
+                }
+
+                template<typename ProvingKey>
+                std::vector<std::uint8_t> write_r1cs_gg_ppzksnark_proving_key_image(const ProvingKey &pk) {
+                    std::vector<std::uint8_t> result(r1cs_gg_ppzksnark_proving_key_image_size(pk));
+                    write_r1cs_gg_ppzksnark_proving_key_image(pk, result.data());
+                    return result;
+                }
+
+                /// @brief Zero-copy view of a proving key image.
+                /// @details The view does not own the image bytes, which must outlive it.
+                template<typename ProvingKey>
+                class r1cs_gg_ppzksnark_proving_key_image {
+                public:
+                    using g1_type = typename ProvingKey::curve_type::g1_type;
+                    using g2_type = typename ProvingKey::curve_type::g2_type;
+                    using g1_span_type = affine_point_span<g1_type>;
+                    using g2_span_type = affine_point_span<g2_type>;
+                    using section_type = r1cs_gg_ppzksnark_proving_key_image_section;
+
+                    r1cs_gg_ppzksnark_proving_key_image() = default;
+
+                    /// @brief Validate the header and section table and attach to the image.
+                    /// @param[in] verify_checksum Whether to check the payload checksum,
+                    ///     which touches every page of the image.
+                    /// @return invalid_msg_data for a malformed or foreign image,
+                    ///     not_enough_data for a truncated one.
+                    nil::marshalling::status_type open(const std::uint8_t *data, 
+                                                       std::size_t size, 
+                                                       bool verify_checksum = true) {
+                        using g1_layout = affine_point_layout<g1_type>;
+                        using g2_layout = affine_point_layout<g2_type>;
+                        using header_type = r1cs_gg_ppzksnark_proving_key_image_header;
+                        using entry_type = r1cs_gg_ppzksnark_proving_key_image_section_entry;
+
+                        *this = r1cs_gg_ppzksnark_proving_key_image();
+
+                        if (size < sizeof(header_type) + sizeof(sections_)) {
+                            return nil::marshalling::status_type::not_enough_data;
+                        }
+                        if (reinterpret_cast<std::uintptr_t>(data) % alignof(std::uint64_t) != 0) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+
+                        header_type header;
+                        std::memcpy(&header, data, sizeof(header));
+                        if (header.magic != detail::proving_key_image_magic || 
+                            header.byte_order != detail::proving_key_image_byte_order || 
+                            header.version != detail::proving_key_image_version || 
+                            header.limb_bits != g1_layout::limb_bits || 
+                            header.g1_point_limbs != g1_layout::point_limbs || 
+                            header.g2_point_limbs != g2_layout::point_limbs || 
+                            header.sections_count != detail::proving_key_image_sections_count) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+                        if (header.payload_size != size - sizeof(header)) {
+                            return header.payload_size > size - sizeof(header) ? 
+                                nil::marshalling::status_type::not_enough_data : 
+                                nil::marshalling::status_type::invalid_msg_data;
+                        }
+                        if (verify_checksum && 
+                            header.checksum != detail::proving_key_image_checksum(
+                                data + sizeof(header), data + size)) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+
+                        std::array<entry_type, detail::proving_key_image_sections_count> sections;
+                        std::memcpy(sections.data(), data + sizeof(header), sizeof(sections));
+
+                        const std::array<std::size_t, detail::proving_key_image_sections_count> 
+                            element_sizes = {{
+                                g1_layout::point_size, g2_layout::point_size, 
+                                g1_layout::point_size, sizeof(std::uint64_t), 
+                                g1_layout::point_size, g2_layout::point_size, 
+                                g1_layout::point_size, g1_layout::point_size}};
+                        // Sections follow the section table in order and never overlap
+                        // it or each other.
+                        std::size_t sections_end = sizeof(header) + sizeof(sections);
+                        for (std::size_t i = 0; i < detail::proving_key_image_sections_count; i++) {
+                            if (sections[i].offset % detail::proving_key_image_alignment != 0 || 
+                                sections[i].offset < sections_end || 
+                                sections[i].offset > size || 
+                                sections[i].count > (size - sections[i].offset) / element_sizes[i]) {
+                                return nil::marshalling::status_type::invalid_msg_data;
+                            }
+                            sections_end = sections[i].offset + sections[i].count * element_sizes[i];
+                        }
+                        if (sections[static_cast<std::size_t>(section_type::g1_fixed)].count != 3 || 
+                            sections[static_cast<std::size_t>(section_type::g2_fixed)].count != 2 || 
+                            sections[static_cast<std::size_t>(section_type::B_query_g1)].count != 
+                                sections[static_cast<std::size_t>(section_type::B_query_indices)].count || 
+                            sections[static_cast<std::size_t>(section_type::B_query_g2)].count != 
+                                sections[static_cast<std::size_t>(section_type::B_query_indices)].count) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+
+                        data_ = data;
+                        sections_ = sections;
+                        B_query_domain_size_ = header.B_query_domain_size;
+                        return nil::marshalling::status_type::success;
+                    }
+
+                    typename g1_type::value_type alpha_g1() const {
+                        return g1_section(section_type::g1_fixed).get(0);
+                    }
+
+                    typename g1_type::value_type beta_g1() const {
+                        return g1_section(section_type::g1_fixed).get(1);
+                    }
+
+                    typename g1_type::value_type delta_g1() const {
+                        return g1_section(section_type::g1_fixed).get(2);
+                    }
+
+                    typename g2_type::value_type beta_g2() const {
+                        return g2_section(section_type::g2_fixed).get(0);
+                    }
+
+                    typename g2_type::value_type delta_g2() const {
+                        return g2_section(section_type::g2_fixed).get(1);
+                    }
+
+                    g1_span_type A_query() const {
+                        return g1_section(section_type::A_query);
+                    }
+
+                    const std::uint64_t *B_query_indices() const {
+                        return reinterpret_cast<const std::uint64_t *>(
+                            data_ + entry(section_type::B_query_indices).offset);
+                    }
+
+                    std::size_t B_query_size() const {
+                        return entry(section_type::B_query_indices).count;
+                    }
+
+                    std::size_t B_query_domain_size() const {
+                        return B_query_domain_size_;
+                    }
+
+                    g1_span_type B_query_g1() const {
+                        return g1_section(section_type::B_query_g1);
+                    }
+
+                    g2_span_type B_query_g2() const {
+                        return g2_section(section_type::B_query_g2);
+                    }
+
+                    g1_span_type H_query() const {
+                        return g1_section(section_type::H_query);
+                    }
+
+                    g1_span_type L_query() const {
+                        return g1_section(section_type::L_query);
+                    }
+
+                private:
+                    const r1cs_gg_ppzksnark_proving_key_image_section_entry &
+                        entry(section_type section) const {
+                        return sections_[static_cast<std::size_t>(section)];
+                    }
+
+                    g1_span_type g1_section(section_type section) const {
+                        return g1_span_type(
+                            reinterpret_cast<const typename g1_span_type::limb_type *>(
+                                data_ + entry(section).offset), 
+                            entry(section).count);
+                    }
+
+                    g2_span_type g2_section(section_type section) const {
+                        return g2_span_type(
+                            reinterpret_cast<const typename g2_span_type::limb_type *>(
+                                data_ + entry(section).offset), 
+                            entry(section).count);
+                    }
+
+                    const std::uint8_t *data_ = nullptr;
+                    std::array<r1cs_gg_ppzksnark_proving_key_image_section_entry, 
+                        detail::proving_key_image_sections_count> sections_ = {};
+                    std::size_t B_query_domain_size_ = 0;
+                };
+
+                /// @brief Proving key image mapped from a file.
+                /// @details The file is mapped read-only and shared, so concurrent
+                ///     provers loading the same key share its pages. Pages are faulted
+                ///     in on first access to a section.
+                template<typename ProvingKey>
+                class mapped_r1cs_gg_ppzksnark_proving_key_image : 
+                    public r1cs_gg_ppzksnark_proving_key_image<ProvingKey> {
+                public:
+                    /// @throws std::system_error if the file cannot be mapped.
+                    explicit mapped_r1cs_gg_ppzksnark_proving_key_image(const std::string &path) : 
+                        file_(path, io::mapped_file::access_pattern::normal) {
+                    }
+
+                    nil::marshalling::status_type open(bool verify_checksum = true) {
+                        return r1cs_gg_ppzksnark_proving_key_image<ProvingKey>::open(
+                            file_.data(), file_.size(), verify_checksum);
+                    }
+
+                private:
+                    io::mapped_file file_;
+                };
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_PROVING_KEY_IMAGE_HPP
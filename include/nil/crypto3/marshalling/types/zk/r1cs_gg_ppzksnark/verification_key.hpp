@@ -29,6 +29,8 @@
 #include <ratio>
 #include <limits>
 #include <type_traits>
+#include <iterator>
+#include <utility>
 
 #include <nil/marshalling/types/bundle.hpp>
 #include <nil/marshalling/types/array_list.hpp>
@@ -96,7 +98,7 @@ namespace nil {
                 r1cs_gg_ppzksnark_verification_key<nil::marshalling::field_type<
                                 Endianness>,
                                 VerificationKey>
-                    fill_r1cs_gg_ppzksnark_verification_key(VerificationKey r1cs_gg_ppzksnark_verification_key_inp){
+                    fill_r1cs_gg_ppzksnark_verification_key(const VerificationKey &r1cs_gg_ppzksnark_verification_key_inp){
 
                     using TTypeBase = nil::marshalling::field_type<
                                 Endianness>;
@@ -142,10 +144,10 @@ namespace nil {
                                 Endianness>,
                                 VerificationKey>(
                                     std::make_tuple(
-                                        filled_alpha_g1_beta_g2, 
-                                        filled_gamma_g2, 
-                                        filled_delta_g2, 
-                                        filled_gamma_ABC_g1
+                                        std::move(filled_alpha_g1_beta_g2), 
+                                        std::move(filled_gamma_g2), 
+                                        std::move(filled_delta_g2), 
+                                        std::move(filled_gamma_ABC_g1)
                                         ));
                 }
 
@@ -153,9 +155,9 @@ namespace nil {
                           typename Endianness>
                 VerificationKey
                     construct_r1cs_gg_ppzksnark_verification_key(
-                        r1cs_gg_ppzksnark_verification_key<nil::marshalling::field_type<
+                        const r1cs_gg_ppzksnark_verification_key<nil::marshalling::field_type<
                                 Endianness>,
-                                VerificationKey> filled_r1cs_gg_ppzksnark_verification_key){
+                                VerificationKey> &filled_r1cs_gg_ppzksnark_verification_key){
 
                     return VerificationKey (
                         std::move(construct_field_element<
@@ -163,8 +165,10 @@ namespace nil {
                             Endianness>(
                                 std::get<0>(filled_r1cs_gg_ppzksnark_verification_key.value()))
                             ),
-                        std::move(std::get<1>(filled_r1cs_gg_ppzksnark_verification_key.value()).value()),
-                        std::move(std::get<2>(filled_r1cs_gg_ppzksnark_verification_key.value()).value()),
+                        typename VerificationKey::curve_type::g2_type::value_type(
+                            std::get<1>(filled_r1cs_gg_ppzksnark_verification_key.value()).value()),
+                        typename VerificationKey::curve_type::g2_type::value_type(
+                            std::get<2>(filled_r1cs_gg_ppzksnark_verification_key.value()).value()),
                         std::move(construct_accumulation_vector<
                             zk::snark::accumulation_vector<
                                 typename VerificationKey::curve_type::g1_type>, 
@@ -173,6 +177,197 @@ namespace nil {
                             );
                 }
 
+                /// @brief Verification key specialized to a fixed prefix of the primary input.
+                /// @details gamma_ABC_g1 already has the prefix accumulated into its first
+                ///     element and the consumed indices dropped from its sparse part. The
+                ///     prefix length is stored in front of the key, so the verifier knows
+                ///     the offset the remaining primary input has to be accumulated at.
+                template<typename TTypeBase, 
+                         typename VerificationKey,
+                         typename = typename std::enable_if<
+                             std::is_same<VerificationKey, 
+                                zk::snark::r1cs_gg_ppzksnark_verification_key<
+                                    typename VerificationKey::curve_type
+                                >
+                             >::value,
+                             bool>::type,
+                         typename... TOptions>
+                using r1cs_gg_ppzksnark_partial_verification_key = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // accumulated primary input prefix length
+                            nil::marshalling::types::integral<
+                                TTypeBase, 
+                                std::size_t
+                            >,
+                            // verification key with partially accumulated gamma_ABC_g1
+                            r1cs_gg_ppzksnark_verification_key<
+                                TTypeBase, 
+                                VerificationKey
+                            >
+                        >
+                    >;
+
+                template <typename VerificationKey, 
+                          typename Endianness,
+                          typename InputIterator>
+                r1cs_gg_ppzksnark_partial_verification_key<nil::marshalling::field_type<
+                                Endianness>,
+                                VerificationKey>
+                    fill_r1cs_gg_ppzksnark_partial_verification_key(
+                        const VerificationKey &r1cs_gg_ppzksnark_verification_key_inp,
+                        InputIterator primary_input_prefix_begin,
+                        InputIterator primary_input_prefix_end){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using integral_type = 
+                        nil::marshalling::types::integral<
+                            TTypeBase,
+                            std::size_t
+                        >;
+
+                    VerificationKey specialized_verification_key(
+                        r1cs_gg_ppzksnark_verification_key_inp.alpha_g1_beta_g2, 
+                        r1cs_gg_ppzksnark_verification_key_inp.gamma_g2, 
+                        r1cs_gg_ppzksnark_verification_key_inp.delta_g2, 
+                        r1cs_gg_ppzksnark_verification_key_inp.gamma_ABC_g1.accumulate_chunk(
+                            primary_input_prefix_begin, 
+                            primary_input_prefix_end, 
+                            0));
+
+                    return r1cs_gg_ppzksnark_partial_verification_key<nil::marshalling::field_type<
+                                Endianness>,
+                                VerificationKey>(
+                                    std::make_tuple(
+                                        integral_type(std::distance(primary_input_prefix_begin, 
+                                                                    primary_input_prefix_end)),
+                                        fill_r1cs_gg_ppzksnark_verification_key<
+                                            VerificationKey, 
+                                            Endianness>(specialized_verification_key)
+                                        ));
+                }
+
+                /// @return Verification key with partially accumulated gamma_ABC_g1 and the
+                ///     offset at which the rest of the primary input has to be accumulated.
+                template <typename VerificationKey, 
+                          typename Endianness>
+                std::pair<VerificationKey, std::size_t>
+                    construct_r1cs_gg_ppzksnark_partial_verification_key(
+                        const r1cs_gg_ppzksnark_partial_verification_key<nil::marshalling::field_type<
+                                Endianness>,
+                                VerificationKey> &filled_r1cs_gg_ppzksnark_partial_verification_key){
+
+                    return std::make_pair(
+                        construct_r1cs_gg_ppzksnark_verification_key<
+                            VerificationKey, 
+                            Endianness>(
+                                std::get<1>(filled_r1cs_gg_ppzksnark_partial_verification_key.value())),
+                        std::get<0>(filled_r1cs_gg_ppzksnark_partial_verification_key.value()).value());
+                }
+
+                template <typename VerificationKey, 
+                          typename Endianness>
+                std::size_t r1cs_gg_ppzksnark_verification_key_serialized_size(
+                    const VerificationKey &r1cs_gg_ppzksnark_verification_key_inp){
+
+                    using curve_type = typename VerificationKey::curve_type;
+
+                    return field_element_serialized_size<
+                            typename curve_type::gt_type, 
+                            Endianness>() + 
+                        2 * curve_element_serialized_size<
+                            typename curve_type::g2_type, 
+                            Endianness>() + 
+                        accumulation_vector_serialized_size<
+                            zk::snark::accumulation_vector<
+                                typename curve_type::g1_type>, 
+                            Endianness>(r1cs_gg_ppzksnark_verification_key_inp.gamma_ABC_g1);
+                }
+
+                /// @brief Write the key as the bundle produced by
+                ///     fill_r1cs_gg_ppzksnark_verification_key does, without constructing it.
+                /// @pre At least
+                ///     r1cs_gg_ppzksnark_verification_key_serialized_size() units can be written, unless the
+                ///     iterator is an output iterator such as std::back_inserter.
+                /// @post The iterator is advanced.
+                template <typename VerificationKey, 
+                          typename Endianness, 
+                          typename TIter>
+                void write_r1cs_gg_ppzksnark_verification_key_data(
+                    const VerificationKey &r1cs_gg_ppzksnark_verification_key_inp, 
+                    TIter &iter){
+
+                    using curve_type = typename VerificationKey::curve_type;
+
+                    write_field_element_data<
+                        typename curve_type::gt_type, 
+                        Endianness>(r1cs_gg_ppzksnark_verification_key_inp.alpha_g1_beta_g2, iter);
+                    write_curve_element_data<
+                        typename curve_type::g2_type, 
+                        Endianness>(r1cs_gg_ppzksnark_verification_key_inp.gamma_g2, iter);
+                    write_curve_element_data<
+                        typename curve_type::g2_type, 
+                        Endianness>(r1cs_gg_ppzksnark_verification_key_inp.delta_g2, iter);
+                    write_accumulation_vector_data<
+                        zk::snark::accumulation_vector<
+                            typename curve_type::g1_type>, 
+                        Endianness>(r1cs_gg_ppzksnark_verification_key_inp.gamma_ABC_g1, iter);
+                }
+
+                /// @brief Read a key written by write_r1cs_gg_ppzksnark_verification_key_data
+                ///     straight into the native type.
+                /// @param[in, out] iter Iterator to read the data, advanced on success.
+                /// @param[in, out] size Number of bytes available for reading, decreased on success.
+                /// @param[out] status Status of read operation.
+                template <typename VerificationKey, 
+                          typename Endianness, 
+                          typename TIter>
+                VerificationKey read_r1cs_gg_ppzksnark_verification_key_data(
+                    TIter &iter, 
+                    std::size_t &size, 
+                    nil::marshalling::status_type &status){
+
+                    using curve_type = typename VerificationKey::curve_type;
+
+                    const std::size_t fixed_part_size = 
+                        field_element_serialized_size<
+                            typename curve_type::gt_type, 
+                            Endianness>() + 
+                        2 * curve_element_serialized_size<
+                            typename curve_type::g2_type, 
+                            Endianness>();
+                    if (size < fixed_part_size) {
+                        status = nil::marshalling::status_type::not_enough_data;
+                        return VerificationKey();
+                    }
+
+                    typename curve_type::gt_type::value_type alpha_g1_beta_g2 = 
+                        read_field_element_data<
+                            typename curve_type::gt_type, 
+                            Endianness>(iter, size, status);
+                    typename curve_type::g2_type::value_type gamma_g2 = 
+                        read_curve_element_data<
+                            typename curve_type::g2_type, 
+                            Endianness>(iter, size, status);
+                    typename curve_type::g2_type::value_type delta_g2 = 
+                        read_curve_element_data<
+                            typename curve_type::g2_type, 
+                            Endianness>(iter, size, status);
+
+                    return VerificationKey (
+                        std::move(alpha_g1_beta_g2),
+                        std::move(gamma_g2),
+                        std::move(delta_g2),
+                        read_accumulation_vector_data<
+                            zk::snark::accumulation_vector<
+                                typename curve_type::g1_type>, 
+                            Endianness>(iter, size, status)
+                        );
+                }
+
             }    // namespace types
         }        // namespace marshalling
     }        // namespace crypto3
@@ -0,0 +1,294 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_VERIFIER_INPUT_HPP
+#define CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_VERIFIER_INPUT_HPP
+
+#include <ratio>
+#include <limits>
+#include <type_traits>
+#include <tuple>
+#include <utility>
+
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/types/tag.hpp>
+#include <nil/marshalling/types/detail/adapt_basic_field.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/zk/snark/relations/constraint_satisfaction_problems/r1cs.hpp>
+#include <nil/crypto3/zk/snark/schemes/ppzksnark/r1cs_gg_ppzksnark/proof.hpp>
+#include <nil/crypto3/zk/snark/schemes/ppzksnark/r1cs_gg_ppzksnark/verification_key.hpp>
+
+#include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/proof.hpp>
+#include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/primary_input.hpp>
+#include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/verification_key.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+
+                /// @brief Sections of the verifier input, in the order they are stored.
+                enum class r1cs_gg_ppzksnark_verifier_input_section : std::size_t {
+                    proof = 0,
+                    primary_input = 1,
+                    verification_key = 2
+                };
+
+                constexpr static const std::size_t r1cs_gg_ppzksnark_verifier_input_sections_count = 3;
+
+                /// @brief Table of (offset, length) pairs, one per section. Offsets are
+                ///     counted in bytes from the beginning of the verifier input, header
+                ///     included.
+                template<typename TTypeBase>
+                using r1cs_gg_ppzksnark_verifier_input_header = 
+                    nil::marshalling::types::array_list<
+                        TTypeBase,
+                        nil::marshalling::types::integral<
+                            TTypeBase, 
+                            std::size_t
+                        >,
+                        nil::marshalling::option::sequence_fixed_size<
+                            2 * r1cs_gg_ppzksnark_verifier_input_sections_count
+                        > 
+                    >;
+
+                template<typename TTypeBase, 
+                         typename VerificationKey,
+                         typename = typename std::enable_if<
+                             std::is_same<VerificationKey, 
+                                zk::snark::r1cs_gg_ppzksnark_verification_key<
+                                    typename VerificationKey::curve_type
+                                >
+                             >::value,
+                             bool>::type,
+                         typename... TOptions>
+                using r1cs_gg_ppzksnark_verifier_input = 
+                    nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<
+                            // sections offsets and lengths
+                            r1cs_gg_ppzksnark_verifier_input_header<
+                                TTypeBase
+                            >,
+                            // proof
+                            r1cs_gg_ppzksnark_proof<
+                                TTypeBase, 
+                                zk::snark::r1cs_gg_ppzksnark_proof<
+                                    typename VerificationKey::curve_type
+                                >
+                            >,
+                            // primary_input
+                            r1cs_gg_ppzksnark_primary_input<
+                                TTypeBase, 
+                                zk::snark::r1cs_primary_input<
+                                    typename VerificationKey::curve_type::scalar_field_type
+                                >
+                            >,
+                            // verification_key
+                            r1cs_gg_ppzksnark_verification_key<
+                                TTypeBase, 
+                                VerificationKey
+                            >
+                        >
+                    >;
+
+                template <typename VerificationKey, 
+                          typename Endianness>
+                r1cs_gg_ppzksnark_verifier_input<nil::marshalling::field_type<
+                                Endianness>,
+                                VerificationKey>
+                    fill_r1cs_gg_ppzksnark_verifier_input(
+                        const zk::snark::r1cs_gg_ppzksnark_proof<
+                            typename VerificationKey::curve_type> &r1cs_gg_ppzksnark_proof_inp,
+                        const zk::snark::r1cs_primary_input<
+                            typename VerificationKey::curve_type::scalar_field_type> &r1cs_gg_ppzksnark_primary_input_inp,
+                        const VerificationKey &r1cs_gg_ppzksnark_verification_key_inp){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    using proof_type = 
+                        zk::snark::r1cs_gg_ppzksnark_proof<
+                            typename VerificationKey::curve_type>;
+                    using primary_input_type = 
+                        zk::snark::r1cs_primary_input<
+                            typename VerificationKey::curve_type::scalar_field_type>;
+
+                    using size_type = 
+                        nil::marshalling::types::integral<
+                            TTypeBase, 
+                            std::size_t
+                        >;
+
+                    auto filled_proof = 
+                        fill_r1cs_gg_ppzksnark_proof<
+                            proof_type, 
+                            Endianness>(r1cs_gg_ppzksnark_proof_inp);
+                    auto filled_primary_input = 
+                        fill_r1cs_gg_ppzksnark_primary_input<
+                            primary_input_type, 
+                            Endianness>(r1cs_gg_ppzksnark_primary_input_inp);
+                    auto filled_verification_key = 
+                        fill_r1cs_gg_ppzksnark_verification_key<
+                            VerificationKey, 
+                            Endianness>(r1cs_gg_ppzksnark_verification_key_inp);
+
+                    const std::size_t lengths[r1cs_gg_ppzksnark_verifier_input_sections_count] = {
+                        filled_proof.length(), 
+                        filled_primary_input.length(), 
+                        filled_verification_key.length()};
+
+                    r1cs_gg_ppzksnark_verifier_input_header<TTypeBase> filled_header;
+                    auto &filled_header_val = filled_header.value();
+                    filled_header_val.reserve(2 * r1cs_gg_ppzksnark_verifier_input_sections_count);
+
+                    std::size_t offset = 
+                        2 * r1cs_gg_ppzksnark_verifier_input_sections_count * size_type::max_length();
+                    for (std::size_t i = 0; i < r1cs_gg_ppzksnark_verifier_input_sections_count; i++) {
+                        filled_header_val.push_back(size_type(offset));
+                        filled_header_val.push_back(size_type(lengths[i]));
+                        offset += lengths[i];
+                    }
+
+                    return r1cs_gg_ppzksnark_verifier_input<TTypeBase,
+                                VerificationKey>(
+                                    std::make_tuple(
+                                        std::move(filled_header),
+                                        std::move(filled_proof),
+                                        std::move(filled_primary_input),
+                                        std::move(filled_verification_key)));
+                }
+
+                template <typename VerificationKey, 
+                          typename Endianness>
+                std::tuple<
+                    zk::snark::r1cs_gg_ppzksnark_proof<
+                        typename VerificationKey::curve_type>,
+                    zk::snark::r1cs_primary_input<
+                        typename VerificationKey::curve_type::scalar_field_type>,
+                    VerificationKey>
+                    construct_r1cs_gg_ppzksnark_verifier_input(
+                        const r1cs_gg_ppzksnark_verifier_input<nil::marshalling::field_type<
+                                Endianness>,
+                                VerificationKey> &filled_r1cs_gg_ppzksnark_verifier_input){
+
+                    using proof_type = 
+                        zk::snark::r1cs_gg_ppzksnark_proof<
+                            typename VerificationKey::curve_type>;
+                    using primary_input_type = 
+                        zk::snark::r1cs_primary_input<
+                            typename VerificationKey::curve_type::scalar_field_type>;
+
+                    return std::make_tuple(
+                        construct_r1cs_gg_ppzksnark_proof<
+                            proof_type, 
+                            Endianness>(
+                                std::get<1>(filled_r1cs_gg_ppzksnark_verifier_input.value())),
+                        construct_r1cs_gg_ppzksnark_primary_input<
+                            primary_input_type, 
+                            Endianness>(
+                                std::get<2>(filled_r1cs_gg_ppzksnark_verifier_input.value())),
+                        construct_r1cs_gg_ppzksnark_verification_key<
+                            VerificationKey, 
+                            Endianness>(
+                                std::get<3>(filled_r1cs_gg_ppzksnark_verifier_input.value())));
+                }
+
+                /// @brief Locate a section of a serialized verifier input by reading only
+                ///     its header.
+                /// @param[in] iter Iterator to the beginning of the verifier input.
+                /// @param[in] size Number of bytes available for reading.
+                /// @param[in] section Section to locate.
+                /// @param[out] status Status of read operation.
+                /// @return Offset of the section from iter and its length in bytes.
+                template <typename Endianness, 
+                          typename TIter>
+                std::pair<std::size_t, std::size_t>
+                    read_r1cs_gg_ppzksnark_verifier_input_section(
+                        TIter iter, 
+                        std::size_t size, 
+                        r1cs_gg_ppzksnark_verifier_input_section section, 
+                        nil::marshalling::status_type &status){
+
+                    using TTypeBase = nil::marshalling::field_type<
+                                Endianness>;
+
+                    r1cs_gg_ppzksnark_verifier_input_header<TTypeBase> header;
+                    status = header.read(iter, size);
+                    if (status != nil::marshalling::status_type::success) {
+                        return std::make_pair(0, 0);
+                    }
+
+                    const std::size_t index = 2 * static_cast<std::size_t>(section);
+                    const std::size_t offset = header.value()[index].value();
+                    const std::size_t length = header.value()[index + 1].value();
+
+                    if (offset < header.length() || offset > size || length > size - offset) {
+                        status = nil::marshalling::status_type::invalid_msg_data;
+                        return std::make_pair(0, 0);
+                    }
+
+                    return std::make_pair(offset, length);
+                }
+
+                template <typename VerificationKey, 
+                          typename Endianness>
+                std::size_t r1cs_gg_ppzksnark_verifier_input_serialized_size(
+                    const zk::snark::r1cs_primary_input<
+                        typename VerificationKey::curve_type::scalar_field_type> &r1cs_gg_ppzksnark_primary_input_inp,
+                    const VerificationKey &r1cs_gg_ppzksnark_verification_key_inp){
+
+                    using proof_type = 
+                        zk::snark::r1cs_gg_ppzksnark_proof<
+                            typename VerificationKey::curve_type>;
+                    using primary_input_type = 
+                        zk::snark::r1cs_primary_input<
+                            typename VerificationKey::curve_type::scalar_field_type>;
+
+                    return r1cs_gg_ppzksnark_verifier_input_header<
+                            nil::marshalling::field_type<
+                                Endianness>>::max_length() + 
+                        r1cs_gg_ppzksnark_proof_serialized_size<
+                            proof_type, 
+                            Endianness>() + 
+                        r1cs_gg_ppzksnark_primary_input_serialized_size<
+                            primary_input_type, 
+                            Endianness>(r1cs_gg_ppzksnark_primary_input_inp) + 
+                        r1cs_gg_ppzksnark_verification_key_serialized_size<
+                            VerificationKey, 
+                            Endianness>(r1cs_gg_ppzksnark_verification_key_inp);
+                }
+
+            }    // namespace types
+        }        // namespace marshalling
+    }        // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_R1CS_GG_PPZKSNARK_VERIFIER_INPUT_HPP
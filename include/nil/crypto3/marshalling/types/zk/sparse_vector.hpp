@@ -43,6 +43,7 @@
 #include <nil/crypto3/zk/snark/sparse_vector.hpp>
 
 #include <nil/crypto3/marshalling/types/algebra/curve_element.hpp>
+#include <nil/crypto3/marshalling/types/algebra/curve_element_planes.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -101,7 +102,7 @@ namespace nil {
                 sparse_vector<nil::marshalling::field_type<
                                 Endianness>,
                                 SparseVector>
-                    fill_sparse_vector(SparseVector sparse_vector_inp){
+                    fill_sparse_vector(const SparseVector &sparse_vector_inp){
 
                     using TTypeBase = nil::marshalling::field_type<
                                 Endianness>;
@@ -123,6 +124,7 @@ namespace nil {
                     integral_vector_type filled_indices;
 
                     std::vector<integral_type> &filled_indices_val = filled_indices.value();
+                    filled_indices_val.reserve(sparse_vector_inp.indices.size());
                     for (std::size_t i=0; 
                          i<sparse_vector_inp.indices.size();
                          i++){
@@ -134,7 +136,7 @@ namespace nil {
                                 Endianness>,
                                 SparseVector>(
                                     std::make_tuple(
-                                        filled_indices,
+                                        std::move(filled_indices),
                                         fill_curve_element_vector<
                                             typename SparseVector::group_type, 
                                             Endianness>(sparse_vector_inp.values),
@@ -145,9 +147,9 @@ namespace nil {
                           typename Endianness>
                 SparseVector
                     construct_sparse_vector(
-                        sparse_vector<nil::marshalling::field_type<
+                        const sparse_vector<nil::marshalling::field_type<
                                 Endianness>,
-                                SparseVector> filled_sparse_vector){
+                                SparseVector> &filled_sparse_vector){
 
                     using TTypeBase = nil::marshalling::field_type<
                                 Endianness>;
@@ -159,9 +161,10 @@ namespace nil {
                         >;
 
                     std::vector<std::size_t> constructed_indices;
-                    std::vector<integral_type> &filled_indices = 
+                    const std::vector<integral_type> &filled_indices = 
                         std::get<0>(filled_sparse_vector.value()).value();
                     std::size_t size = filled_indices.size();
+                    constructed_indices.reserve(size);
 
                     for (std::size_t i=0; 
                          i<size;
@@ -171,7 +174,7 @@ namespace nil {
                     }
 
                     SparseVector result;
-                    result.indices = constructed_indices;
+                    result.indices = std::move(constructed_indices);
                     result.values = 
                         construct_curve_element_vector<
                             typename SparseVector::group_type, 
@@ -183,6 +186,170 @@ namespace nil {
                     return result;
                 }
 
+                template <typename SparseVector, 
+                          typename Endianness>
+                std::size_t sparse_vector_serialized_size(const SparseVector &sparse_vector_inp){
+
+                    using size_type = 
+                        nil::marshalling::types::integral<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            std::size_t
+                        >;
+
+                    return size_type::max_length() + 
+                        sparse_vector_inp.indices.size() * size_type::max_length() + 
+                        curve_element_vector_serialized_size<
+                            typename SparseVector::group_type, 
+                            Endianness>(sparse_vector_inp.values) + 
+                        size_type::max_length();
+                }
+
+                /// @brief Write the sparse vector as the bundle produced by
+                ///     fill_sparse_vector does, without constructing it.
+                /// @post The iterator is advanced.
+                template <typename SparseVector, 
+                          typename Endianness, 
+                          typename TIter>
+                void write_sparse_vector_data(const SparseVector &sparse_vector_inp, 
+                                              TIter &iter){
+
+                    using size_type = 
+                        nil::marshalling::types::integral<
+                            nil::marshalling::field_type<
+                                Endianness>,
+                            std::size_t
+                        >;
+
+                    size_type(sparse_vector_inp.indices.size()).write(iter, size_type::max_length());
+                    for (std::size_t index : sparse_vector_inp.indices){
+                        size_type(index).write(iter, size_type::max_length());
+                    }
+
+                    write_curve_element_vector_data<
+                        typename SparseVector::group_type, 
+                        Endianness>(sparse_vector_inp.values, iter);
+
+                    size_type(sparse_vector_inp.domain_size_).write(iter, size_type::max_length());
+                }
+
+                namespace detail {
+                    /// @brief Read the layout written by write_sparse_vector_data into
+                    ///     result, with the values decoded by
+                    ///     read_values(iter, size, status).
+                    template <typename Endianness, 
+                              typename Result, 
+                              typename TIter, 
+                              typename ReadValues>
+                    void read_sparse_vector_layout(Result &result, 
+                                                   TIter &iter, 
+                                                   std::size_t &size, 
+                                                   nil::marshalling::status_type &status, 
+                                                   ReadValues read_values){
+
+                        using size_type = 
+                            nil::marshalling::types::integral<
+                                nil::marshalling::field_type<
+                                    Endianness>,
+                                std::size_t
+                            >;
+
+                        if (size < size_type::max_length()) {
+                            status = nil::marshalling::status_type::not_enough_data;
+                            return;
+                        }
+                        size_type indices_count;
+                        status = indices_count.read(iter, size);
+                        size -= size_type::max_length();
+
+                        if (indices_count.value() > size / size_type::max_length()) {
+                            status = nil::marshalling::status_type::not_enough_data;
+                            return;
+                        }
+
+                        result.indices.reserve(indices_count.value());
+                        for (std::size_t i = 0; i < indices_count.value(); i++){
+                            size_type index;
+                            index.read(iter, size);
+                            result.indices.push_back(index.value());
+                        }
+                        size -= indices_count.value() * size_type::max_length();
+
+                        result.values = read_values(iter, size, status);
+                        if (status != nil::marshalling::status_type::success) {
+                            return;
+                        }
+                        if (result.values.size() != result.indices.size()) {
+                            status = nil::marshalling::status_type::invalid_msg_data;
+                            return;
+                        }
+
+                        if (size < size_type::max_length()) {
+                            status = nil::marshalling::status_type::not_enough_data;
+                            return;
+                        }
+                        size_type domain_size;
+                        status = domain_size.read(iter, size);
+                        size -= size_type::max_length();
+                        result.domain_size_ = domain_size.value();
+                    }
+                }    // namespace detail
+
+                /// @brief Read a sparse vector written by write_sparse_vector_data
+                ///     straight into the native type.
+                /// @param[in, out] iter Iterator to read the data, advanced on success.
+                /// @param[in, out] size Number of bytes available for reading, decreased on success.
+                /// @param[out] status Status of read operation.
+                template <typename SparseVector, 
+                          typename Endianness, 
+                          typename TIter>
+                SparseVector read_sparse_vector_data(TIter &iter, 
+                                                     std::size_t &size, 
+                                                     nil::marshalling::status_type &status){
+
+                    SparseVector result;
+                    detail::read_sparse_vector_layout<Endianness>(result, iter, size, status, 
+                        [](TIter &values_iter, 
+                           std::size_t &values_size, 
+                           nil::marshalling::status_type &values_status) {
+                            return read_curve_element_vector_data<
+                                typename SparseVector::group_type, 
+                                Endianness>(values_iter, values_size, values_status);
+                        });
+                    return result;
+                }
+
+                /// @brief Sparse vector whose values are decoded into coordinate planes.
+                template <typename CurveGroupType>
+                struct sparse_vector_coordinate_planes {
+                    std::vector<std::size_t> indices;
+                    curve_element_coordinate_planes<CurveGroupType> values;
+                    std::size_t domain_size_ = 0;
+                };
+
+                /// @brief Read a sparse vector written by write_sparse_vector_data,
+                ///     decoding its values straight into coordinate planes.
+                template <typename SparseVector, 
+                          typename Endianness, 
+                          typename TIter>
+                sparse_vector_coordinate_planes<typename SparseVector::group_type>
+                    read_sparse_vector_coordinate_planes_data(
+                        TIter &iter, 
+                        std::size_t &size, 
+                        nil::marshalling::status_type &status){
+
+                    sparse_vector_coordinate_planes<typename SparseVector::group_type> result;
+                    detail::read_sparse_vector_layout<Endianness>(result, iter, size, status, 
+                        [](TIter &values_iter, 
+                           std::size_t &values_size, 
+                           nil::marshalling::status_type &values_status) {
+                            return read_curve_element_coordinate_planes_data<
+                                typename SparseVector::group_type, 
+                                Endianness>(values_iter, values_size, values_status);
+                        });
+                    return result;
+                }
+
             }    // namespace types
         }        // namespace marshalling
     }        // namespace crypto3
@@ -47,6 +47,8 @@
 #include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
 
 #include <nil/crypto3/marshalling/types/algebra/curve_element.hpp>
+#include <nil/crypto3/marshalling/types/algebra/pmr_vector.hpp>
+#include <nil/crypto3/marshalling/types/parallel_array_list.hpp>
 
 template <typename TIter>
 void print_byteblob(TIter iter_begin, TIter iter_end){
@@ -91,8 +93,11 @@ void test_curve_element_non_fixed_size_container(
     std::size_t unitblob_size = 
         curve_element_type::bit_length()/units_bits + 
         ((curve_element_type::bit_length()%units_bits)?1:0);
+    BOOST_CHECK(unitblob_size == 
+        types::curve_element_serialized_size<CurveGroup, Endianness>());
     std::vector<unit_type> cv;
-    cv.resize(unitblob_size*TSize+sizeof(std::size_t), 0x00);
+    cv.resize(types::curve_element_vector_serialized_size<CurveGroup, 
+        Endianness>(val_container), 0x00);
 
     std::vector<curve_element_type> container_data;
 
@@ -131,6 +136,57 @@ void test_curve_element_non_fixed_size_container(
     BOOST_CHECK(std::equal(test_val.value().begin(), 
                            test_val.value().end(),
                            test_val_read.value().begin()));
+
+    std::vector<unit_type> parallel_cv(cv.size(), 0x00);
+    auto parallel_write_iter = parallel_cv.begin();
+    types::write_curve_element_vector_data_parallel<CurveGroup, 
+        Endianness>(val_container, parallel_write_iter, 3);
+    BOOST_CHECK(parallel_write_iter == parallel_cv.end());
+    BOOST_CHECK(parallel_cv == cv);
+
+    std::vector<unit_type> list_cv(cv.size(), 0x00);
+    auto list_write_iter = list_cv.begin();
+    status = types::write_array_list_parallel(test_val, 
+        list_write_iter, list_cv.size(), 3);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(list_write_iter == list_cv.end());
+    BOOST_CHECK(list_cv == cv);
+
+    std::pmr::monotonic_buffer_resource arena;
+    auto pmr_val = 
+        types::fill_curve_element_vector<CurveGroup, 
+            Endianness, 
+            types::pmr_curve_element_vector<
+                nil::marshalling::field_type<Endianness>, 
+                CurveGroup>>(val_container, &arena);
+    BOOST_CHECK(pmr_val.value().get_allocator().resource() == &arena);
+
+    std::vector<unit_type> pmr_cv(pmr_val.length(), 0x00);
+    auto pmr_write_iter = pmr_cv.begin();
+    status = pmr_val.write(pmr_write_iter, pmr_cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(pmr_cv == cv);
+
+    std::pmr::vector<typename CurveGroup::value_type> pmr_constructed_val = 
+        types::construct_curve_element_vector<CurveGroup, 
+            Endianness, 
+            std::pmr::vector<typename CurveGroup::value_type>>(pmr_val, &arena);
+    BOOST_CHECK(std::equal(val_container.begin(), 
+                           val_container.end(), 
+                           pmr_constructed_val.begin()));
+
+    auto pmr_read_iter = cv.cbegin();
+    std::size_t pmr_read_size = cv.size();
+    std::pmr::vector<typename CurveGroup::value_type> pmr_read_val = 
+        types::read_curve_element_vector_data<CurveGroup, 
+            Endianness, 
+            std::pmr::vector<typename CurveGroup::value_type>>(pmr_read_iter, pmr_read_size, status, &arena);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(pmr_read_val.get_allocator().resource() == &arena);
+    BOOST_CHECK(pmr_read_val.size() == val_container.size());
+    BOOST_CHECK(std::equal(val_container.begin(), 
+                           val_container.end(), 
+                           pmr_read_val.begin()));
 }
 
 template<typename Endianness, 
@@ -158,6 +214,64 @@ void test_curve_element_non_fixed_size_container() {
 }
 
 
+template<typename Endianness, 
+         class CurveGroup, 
+         std::size_t TSize>
+void test_curve_element_vector_parallel_normalized_first() {
+    using namespace nil::crypto3::marshalling;
+    using unit_type = unsigned char;
+
+    // The leading points have Z == 1 and do not tell the coordinate system apart
+    std::vector<typename CurveGroup::value_type> val_container;
+    val_container.push_back(CurveGroup::value_type::zero());
+    val_container.push_back(nil::crypto3::algebra::random_element<CurveGroup>().to_affine());
+    val_container.push_back(nil::crypto3::algebra::random_element<CurveGroup>().to_affine());
+    for (std::size_t i=0; i<TSize; i++){
+        val_container.push_back(nil::crypto3::algebra::random_element<CurveGroup>());
+    }
+
+    auto filled_val = types::fill_curve_element_vector<CurveGroup, Endianness>(val_container);
+    std::vector<unit_type> cv(filled_val.length(), 0x00);
+    auto write_iter = cv.begin();
+    BOOST_CHECK(filled_val.write(write_iter, cv.size()) == nil::marshalling::status_type::success);
+
+    std::vector<unit_type> parallel_cv(cv.size(), 0x00);
+    auto parallel_write_iter = parallel_cv.begin();
+    types::write_curve_element_vector_data_parallel<CurveGroup, 
+        Endianness>(val_container, parallel_write_iter, 1);
+    BOOST_CHECK(parallel_write_iter == parallel_cv.end());
+    BOOST_CHECK(parallel_cv == cv);
+
+    // No finite point has Z != 1, e.g. decoded points: the batch result is used as is
+    std::vector<typename CurveGroup::value_type> normalized_container;
+    normalized_container.push_back(CurveGroup::value_type::zero());
+    for (std::size_t i=0; i<TSize; i++){
+        normalized_container.push_back(nil::crypto3::algebra::random_element<CurveGroup>().to_affine());
+    }
+    std::vector<typename CurveGroup::value_type> normalized_affine(normalized_container.size());
+    types::detail::batch_to_affine(normalized_container.data(), normalized_container.size(), 
+        normalized_affine.data());
+    BOOST_CHECK(normalized_affine[0].is_zero());
+    for (std::size_t i=1; i<normalized_container.size(); i++){
+        BOOST_CHECK(normalized_affine[i].X == normalized_container[i].X);
+        BOOST_CHECK(normalized_affine[i].Y == normalized_container[i].Y);
+        BOOST_CHECK(normalized_affine[i].Z == CurveGroup::value_type::underlying_field_type::value_type::one());
+    }
+
+    auto filled_normalized = types::fill_curve_element_vector<CurveGroup, Endianness>(normalized_container);
+    std::vector<unit_type> normalized_cv(filled_normalized.length(), 0x00);
+    write_iter = normalized_cv.begin();
+    BOOST_CHECK(filled_normalized.write(write_iter, normalized_cv.size()) == 
+        nil::marshalling::status_type::success);
+
+    std::vector<unit_type> parallel_normalized_cv(normalized_cv.size(), 0x00);
+    parallel_write_iter = parallel_normalized_cv.begin();
+    types::write_curve_element_vector_data_parallel<CurveGroup, 
+        Endianness>(normalized_container, parallel_write_iter, 2);
+    BOOST_CHECK(parallel_normalized_cv == normalized_cv);
+}
+
+
 BOOST_AUTO_TEST_SUITE(curve_element_non_fixed_size_container_test_suite)
 
 BOOST_AUTO_TEST_CASE(curve_element_non_fixed_size_container_bls12_381_g1) {
@@ -178,4 +292,15 @@ BOOST_AUTO_TEST_CASE(curve_element_non_fixed_size_container_bls12_381_g2) {
     std::cout << "BLS12-381 g2 group non fixed size container test finished" << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(curve_element_vector_parallel_normalized_first_bls12_381) {
+    test_curve_element_vector_parallel_normalized_first<
+        nil::marshalling::option::big_endian, 
+        nil::crypto3::algebra::curves::bls12<381>::g1_type, 
+        16>();
+    test_curve_element_vector_parallel_normalized_first<
+        nil::marshalling::option::big_endian, 
+        nil::crypto3::algebra::curves::bls12<381>::g2_type, 
+        16>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -31,6 +31,8 @@
 #include <boost/random/uniform_int.hpp>
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <cstdint>
 
 #include <nil/marshalling/types/integral.hpp>
 #include <nil/marshalling/status_type.hpp>
@@ -45,6 +47,9 @@
 #include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
 
 #include <nil/crypto3/marshalling/types/algebra/field_element.hpp>
+#include <nil/crypto3/marshalling/types/algebra/compact_field_element.hpp>
+#include <nil/crypto3/marshalling/types/algebra/pmr_vector.hpp>
+#include <nil/crypto3/marshalling/types/parallel_array_list.hpp>
 
 template <typename TIter>
 void print_byteblob(TIter iter_begin, TIter iter_end){
@@ -129,6 +134,115 @@ void test_field_element_non_fixed_size_container(
     BOOST_CHECK(std::equal(val_container.begin(), 
                            val_container.end(), 
                            read_val.begin()));
+
+    std::vector<unit_type> parallel_cv(cv.size(), 0x00);
+    auto parallel_write_iter = parallel_cv.begin();
+    types::write_field_element_vector_data_parallel<FieldType, 
+        Endianness>(val_container, parallel_write_iter, 3);
+    BOOST_CHECK(parallel_write_iter == parallel_cv.end());
+    BOOST_CHECK(parallel_cv == cv);
+
+    std::vector<unit_type> list_cv(cv.size(), 0x00);
+    auto list_write_iter = list_cv.begin();
+    status = types::write_array_list_parallel(test_val, 
+        list_write_iter, list_cv.size(), 3);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(list_write_iter == list_cv.end());
+    BOOST_CHECK(list_cv == cv);
+
+    using field_element_ser_length_vector_type = 
+        nil::marshalling::types::array_list<
+            nil::marshalling::field_type<
+                    Endianness>,
+            types::field_element<
+                nil::marshalling::field_type<
+                    Endianness>,
+                FieldType>,
+            nil::marshalling::option::sequence_ser_length_field_prefix<
+                nil::marshalling::types::integral<
+                    nil::marshalling::field_type<
+                    Endianness>, 
+                    std::size_t
+                >
+            > 
+        >;
+    using field_element_short_count_vector_type = 
+        nil::marshalling::types::array_list<
+            nil::marshalling::field_type<
+                    Endianness>,
+            types::field_element<
+                nil::marshalling::field_type<
+                    Endianness>,
+                FieldType>,
+            nil::marshalling::option::sequence_size_field_prefix<
+                nil::marshalling::types::integral<
+                    nil::marshalling::field_type<
+                    nil::marshalling::option::little_endian>, 
+                    std::uint32_t
+                >
+            > 
+        >;
+
+    field_element_ser_length_vector_type ser_length_val;
+    ser_length_val.value() = test_val.value();
+    std::vector<unit_type> ser_length_cv(ser_length_val.length(), 0x00);
+    auto ser_length_write_iter = ser_length_cv.begin();
+    ser_length_val.write(ser_length_write_iter, ser_length_cv.size());
+    std::vector<unit_type> ser_length_parallel_cv(ser_length_cv.size(), 0x00);
+    auto ser_length_parallel_write_iter = ser_length_parallel_cv.begin();
+    status = types::write_array_list_parallel(ser_length_val, 
+        ser_length_parallel_write_iter, ser_length_parallel_cv.size(), 3);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(ser_length_parallel_cv == ser_length_cv);
+
+    field_element_short_count_vector_type short_count_val;
+    short_count_val.value() = test_val.value();
+    std::vector<unit_type> short_count_cv(short_count_val.length(), 0x00);
+    auto short_count_write_iter = short_count_cv.begin();
+    short_count_val.write(short_count_write_iter, short_count_cv.size());
+    std::vector<unit_type> short_count_parallel_cv(short_count_cv.size(), 0x00);
+    auto short_count_parallel_write_iter = short_count_parallel_cv.begin();
+    status = types::write_array_list_parallel(short_count_val, 
+        short_count_parallel_write_iter, short_count_parallel_cv.size(), 3);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(short_count_parallel_write_iter == short_count_parallel_cv.end());
+    BOOST_CHECK(short_count_parallel_cv == short_count_cv);
+
+    std::pmr::monotonic_buffer_resource arena;
+    auto pmr_val = 
+        types::fill_field_element_vector<FieldType, 
+            Endianness, 
+            types::pmr_field_element_vector<
+                nil::marshalling::field_type<Endianness>, 
+                FieldType>>(val_container, &arena);
+    BOOST_CHECK(pmr_val.value().get_allocator().resource() == &arena);
+
+    std::vector<unit_type> pmr_cv(pmr_val.length(), 0x00);
+    auto pmr_write_iter = pmr_cv.begin();
+    status = pmr_val.write(pmr_write_iter, pmr_cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(pmr_cv == cv);
+
+    std::pmr::vector<typename FieldType::value_type> pmr_constructed_val = 
+        types::construct_field_element_vector<FieldType, 
+            Endianness, 
+            std::pmr::vector<typename FieldType::value_type>>(pmr_val, &arena);
+    BOOST_CHECK(std::equal(val_container.begin(), 
+                           val_container.end(), 
+                           pmr_constructed_val.begin()));
+
+    auto pmr_read_iter = cv.cbegin();
+    std::size_t pmr_read_size = cv.size();
+    std::pmr::vector<typename FieldType::value_type> pmr_read_val = 
+        types::read_field_element_vector_data<FieldType, 
+            Endianness, 
+            std::pmr::vector<typename FieldType::value_type>>(pmr_read_iter, pmr_read_size, status, &arena);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(pmr_read_val.get_allocator().resource() == &arena);
+    BOOST_CHECK(pmr_read_val.size() == val_container.size());
+    BOOST_CHECK(std::equal(val_container.begin(), 
+                           val_container.end(), 
+                           pmr_read_val.begin()));
 }
 
 template<typename FieldType, 
@@ -151,6 +265,182 @@ void test_field_element_non_fixed_size_container() {
     }
 }
 
+template<typename FieldType, 
+         typename Endianness>
+void test_compact_field_element_vector(
+    const std::vector<typename FieldType::value_type> &val_container) {
+
+    using namespace nil::crypto3::marshalling;
+
+    using unit_type = unsigned char;
+    using compact_field_element_vector_type = 
+        types::compact_field_element_vector<
+            nil::marshalling::field_type<
+                Endianness>,
+            FieldType>;
+
+    compact_field_element_vector_type test_val = 
+        types::fill_compact_field_element_vector<FieldType,
+            Endianness>(val_container);
+
+    BOOST_CHECK(test_val.length() == 
+        types::compact_field_element_vector_serialized_size<FieldType, 
+            Endianness>(val_container));
+
+    std::vector<unit_type> cv;
+    cv.resize(test_val.length(), 0x00);
+
+    auto write_iter = cv.begin();
+    nil::marshalling::status_type status =  
+        test_val.write(write_iter, 
+            cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    compact_field_element_vector_type test_val_read;
+
+    auto read_iter = cv.begin();
+    status = 
+        test_val_read.read(read_iter, 
+                cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    std::vector<typename FieldType::value_type> read_val = 
+        types::construct_compact_field_element_vector<FieldType, 
+            Endianness>(
+                test_val_read, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(read_val.size() == val_container.size());
+    BOOST_CHECK(std::equal(val_container.begin(), 
+                           val_container.end(), 
+                           read_val.begin()));
+
+    using indexed_compact_field_element_vector_type = 
+        types::indexed_compact_field_element_vector<
+            nil::marshalling::field_type<
+                Endianness>,
+            FieldType>;
+
+    indexed_compact_field_element_vector_type indexed_val = 
+        types::fill_indexed_compact_field_element_vector<FieldType,
+            Endianness>(val_container, 3);
+    BOOST_CHECK(std::get<3>(indexed_val.value()).value() == 
+        std::get<1>(test_val.value()).value());
+
+    BOOST_CHECK(indexed_val.length() == 
+        types::indexed_compact_field_element_vector_serialized_size<FieldType, 
+            Endianness>(val_container, 3));
+
+    std::vector<unit_type> indexed_cv;
+    indexed_cv.resize(indexed_val.length(), 0x00);
+    auto indexed_write_iter = indexed_cv.begin();
+    status = indexed_val.write(indexed_write_iter, indexed_cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    indexed_compact_field_element_vector_type indexed_val_read;
+    auto indexed_read_iter = indexed_cv.begin();
+    status = indexed_val_read.read(indexed_read_iter, indexed_cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    std::vector<typename FieldType::value_type> indexed_read_val = 
+        types::construct_indexed_compact_field_element_vector<FieldType, 
+            Endianness>(
+                indexed_val_read, status, 2);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(indexed_read_val.size() == val_container.size());
+    BOOST_CHECK(std::equal(val_container.begin(), 
+                           val_container.end(), 
+                           indexed_read_val.begin()));
+
+    for (std::size_t i = 0; i < val_container.size(); i++) {
+        BOOST_CHECK(types::read_indexed_compact_field_element<FieldType, 
+            Endianness>(indexed_val_read, i, status) == val_container[i]);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+    }
+    types::read_indexed_compact_field_element<FieldType, 
+        Endianness>(indexed_val_read, val_container.size(), status);
+    BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+
+    // a block offset that does not match the end of the previous block
+    if (val_container.size() > 3) {
+        std::get<2>(indexed_val_read.value()).value()[1].value() += 1;
+        types::construct_indexed_compact_field_element_vector<FieldType, 
+            Endianness>(indexed_val_read, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+    }
+}
+
+template<typename FieldType, 
+         typename Endianness,
+         std::size_t TSize>
+void test_compact_field_element_vector() {
+    boost::random::mt19937 rng;
+    boost::random::uniform_int_distribution<std::uint64_t> small_dist(0, 0xFFFFFFFF);
+
+    for (unsigned i = 0; i < 128; ++i) {
+        std::vector<typename FieldType::value_type> small_container, random_container;
+        for (std::size_t j = 0; j < TSize; j++) {
+            small_container.push_back( 
+                typename FieldType::value_type(small_dist(rng)));
+            random_container.push_back( 
+                nil::crypto3::algebra::random_element<FieldType>());
+        }
+        small_container.push_back(FieldType::value_type::zero());
+        test_compact_field_element_vector<FieldType, Endianness>(small_container);
+        test_compact_field_element_vector<FieldType, Endianness>(random_container);
+    }
+}
+
+template<typename FieldType, 
+         typename Endianness>
+void test_compact_field_element_vector_non_canonical() {
+    using namespace nil::crypto3::marshalling;
+
+    using compact_field_element_vector_type = 
+        types::compact_field_element_vector<
+            nil::marshalling::field_type<
+                Endianness>,
+            FieldType>;
+
+    constexpr std::size_t max_bytes = 
+        FieldType::modulus_bits / 8 + ((FieldType::modulus_bits % 8)?1:0);
+
+    nil::marshalling::status_type status;
+
+    // 1 encoded with a redundant zero byte
+    compact_field_element_vector_type padded;
+    std::get<0>(padded.value()).value() = 1;
+    if (std::is_same<Endianness, nil::marshalling::option::big_endian>::value) {
+        std::get<1>(padded.value()).value() = {2, 0x00, 0x01};
+    } else {
+        std::get<1>(padded.value()).value() = {2, 0x01, 0x00};
+    }
+    types::construct_compact_field_element_vector<FieldType, Endianness>(padded, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+
+    // value above the modulus
+    compact_field_element_vector_type overflowed;
+    std::get<0>(overflowed.value()).value() = 1;
+    std::get<1>(overflowed.value()).value().assign(max_bytes + 1, 0xFF);
+    std::get<1>(overflowed.value()).value()[0] = max_bytes;
+    types::construct_compact_field_element_vector<FieldType, Endianness>(overflowed, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+
+    // length tag wider than the field
+    compact_field_element_vector_type too_long;
+    std::get<0>(too_long.value()).value() = 1;
+    std::get<1>(too_long.value()).value().assign(max_bytes + 2, 0x01);
+    std::get<1>(too_long.value()).value()[0] = max_bytes + 1;
+    types::construct_compact_field_element_vector<FieldType, Endianness>(too_long, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+
+    // truncated payload
+    compact_field_element_vector_type truncated;
+    std::get<0>(truncated.value()).value() = 1;
+    std::get<1>(truncated.value()).value() = {4, 0x01, 0x02};
+    types::construct_compact_field_element_vector<FieldType, Endianness>(truncated, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::not_enough_data);
+}
+
 BOOST_AUTO_TEST_SUITE(field_element_non_fixed_size_container_test_suite)
 
 BOOST_AUTO_TEST_CASE(field_element_non_fixed_size_container_bls12_381_g1_field_be) {
@@ -185,4 +475,32 @@ BOOST_AUTO_TEST_CASE(field_element_non_fixed_size_container_bls12_381_g2_field_l
     std::cout << "BLS12-381 g2 group field non fixed size container little-endian test finished" << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(compact_field_element_vector_bls12_381_scalar_field_be) {
+    std::cout << "BLS12-381 scalar field compact container big-endian test started" << std::endl;
+    test_compact_field_element_vector<nil::crypto3::algebra::curves::bls12<381>::scalar_field_type, 
+        nil::marshalling::option::big_endian, 
+        5>();
+    test_compact_field_element_vector_non_canonical<nil::crypto3::algebra::curves::bls12<381>::scalar_field_type, 
+        nil::marshalling::option::big_endian>();
+    std::cout << "BLS12-381 scalar field compact container big-endian test finished" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(compact_field_element_vector_bls12_381_scalar_field_le) {
+    std::cout << "BLS12-381 scalar field compact container little-endian test started" << std::endl;
+    test_compact_field_element_vector<nil::crypto3::algebra::curves::bls12<381>::scalar_field_type, 
+        nil::marshalling::option::little_endian, 
+        5>();
+    test_compact_field_element_vector_non_canonical<nil::crypto3::algebra::curves::bls12<381>::scalar_field_type, 
+        nil::marshalling::option::little_endian>();
+    std::cout << "BLS12-381 scalar field compact container little-endian test finished" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(compact_field_element_vector_bls12_381_g2_field_be) {
+    std::cout << "BLS12-381 g2 group field compact container big-endian test started" << std::endl;
+    test_compact_field_element_vector<nil::crypto3::algebra::curves::bls12<381>::g2_type::underlying_field_type, 
+        nil::marshalling::option::big_endian, 
+        7>();
+    std::cout << "BLS12-381 g2 group field compact container big-endian test finished" << std::endl;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
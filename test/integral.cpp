@@ -206,6 +206,7 @@ void test_round_trip_non_fixed_precision_big_endian(T val) {
         nil::marshalling::status_type::success);
 
     BOOST_CHECK(val == test_val.value());
+    BOOST_CHECK(test_val.length() == cv.size());
 
     std::vector<unit_type> test_val_byteblob;
     test_val_byteblob.resize(cv.size());
@@ -242,6 +243,7 @@ void test_round_trip_non_fixed_precision_little_endian(T val) {
         nil::marshalling::status_type::success);
 
     BOOST_CHECK(val == test_val.value());
+    BOOST_CHECK(test_val.length() == cv.size());
 
     std::vector<unsigned char> test_val_byteblob;
     test_val_byteblob.resize(cv.size());
@@ -290,4 +292,17 @@ BOOST_AUTO_TEST_CASE(integral_cpp_int_backend_23) {
         23, 23, nil::crypto3::multiprecision::unsigned_magnitude, nil::crypto3::multiprecision::checked, void>>>();
 }
 
+BOOST_AUTO_TEST_CASE(integral_fixed_precision_number_381) {
+    using number_type = nil::crypto3::marshalling::types::fixed_precision_number<381>;
+    static_assert(nil::crypto3::multiprecision::backends::is_fixed_precision<
+        typename number_type::backend_type>::value, "fixed_precision_number must be fixed precision");
+    static_assert(nil::crypto3::marshalling::types::integral<
+        nil::marshalling::field_type<nil::marshalling::option::big_endian>, 
+        number_type>::bit_length() == 381, "fixed_precision_number must keep its width");
+    static_assert(nil::crypto3::marshalling::types::integral<
+        nil::marshalling::field_type<nil::marshalling::option::big_endian>, 
+        number_type>::length() == 48, "fixed precision length must stay static");
+    test_round_trip_fixed_precision<number_type>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
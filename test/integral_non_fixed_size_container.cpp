@@ -135,6 +135,19 @@ void test_round_trip_non_fixed_size_container_fixed_precision(
                            val_container.end(), 
                            constructed_val.begin()));
 
+    container_type moved_filled_val = 
+        types::fill_integral_vector<T,
+            Endianness>(std::vector<T>(val_vector));
+    BOOST_CHECK(std::equal(filled_val.value().begin(), 
+                           filled_val.value().end(),
+                           moved_filled_val.value().begin()));
+
+    std::vector<T> moved_constructed_val = 
+        types::construct_integral_vector<T, 
+            Endianness>(
+                std::move(moved_filled_val));
+    BOOST_CHECK(moved_constructed_val == val_vector);
+
     std::size_t unitblob_size = 
         integral_type::bit_length()/units_bits + 
         ((integral_type::bit_length()%units_bits)?1:0);
@@ -0,0 +1,222 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE crypto3_marshalling_io_buffered_stream_test
+
+#include <boost/test/unit_test.hpp>
+#include <iostream>
+#include <sstream>
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+
+#include <nil/crypto3/zk/snark/schemes/ppzksnark/r1cs_gg_ppzksnark.hpp>
+
+#include <nil/crypto3/marshalling/types/algebra/field_element.hpp>
+#include <nil/crypto3/marshalling/types/algebra/curve_element.hpp>
+#include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/proof.hpp>
+#include <nil/crypto3/marshalling/io/buffered_writer.hpp>
+#include <nil/crypto3/marshalling/io/buffered_reader.hpp>
+
+template<typename SchemeType, 
+         typename Endianness>
+void test_proof_stream() {
+    using namespace nil::crypto3::marshalling;
+
+    using scheme_proof_type = typename SchemeType::proof_type;
+    using curve_type = typename scheme_proof_type::curve_type;
+    using proof_type = types::r1cs_gg_ppzksnark_proof<
+        nil::marshalling::field_type<
+            Endianness>,
+        scheme_proof_type>;
+
+    std::vector<scheme_proof_type> vals;
+    std::stringstream stream;
+    {
+        io::buffered_writer<io::ostream_device> writer(io::ostream_device(stream), 1000);
+        for (unsigned i = 0; i < 16; ++i) {
+            vals.emplace_back(
+                nil::crypto3::algebra::random_element<typename curve_type::g1_type>(), 
+                nil::crypto3::algebra::random_element<typename curve_type::g2_type>(), 
+                nil::crypto3::algebra::random_element<typename curve_type::g1_type>());
+            BOOST_CHECK(writer.write(types::fill_r1cs_gg_ppzksnark_proof<
+                scheme_proof_type, Endianness>(vals.back())) == nil::marshalling::status_type::success);
+        }
+        writer.flush();
+    }
+
+    BOOST_CHECK(stream.str().size() == 
+        vals.size() * types::r1cs_gg_ppzksnark_proof_serialized_size<scheme_proof_type, Endianness>());
+
+    io::buffered_reader<io::istream_device> reader(io::istream_device(stream), 1000);
+    for (const scheme_proof_type &val : vals) {
+        proof_type filled_val;
+        BOOST_CHECK(reader.read(filled_val, proof_type::max_length()) == 
+            nil::marshalling::status_type::success);
+        BOOST_CHECK(val == 
+            types::construct_r1cs_gg_ppzksnark_proof<scheme_proof_type, Endianness>(filled_val));
+    }
+
+    proof_type filled_val;
+    BOOST_CHECK(reader.read(filled_val, proof_type::max_length()) == 
+        nil::marshalling::status_type::not_enough_data);
+
+    // The destructor flushes what was not flushed explicitly
+    std::stringstream unflushed_stream;
+    {
+        io::buffered_writer<io::ostream_device> writer(io::ostream_device(unflushed_stream), 1000);
+        BOOST_CHECK(writer.write(types::fill_r1cs_gg_ppzksnark_proof<
+            scheme_proof_type, Endianness>(vals.front())) == nil::marshalling::status_type::success);
+    }
+    BOOST_CHECK(unflushed_stream.str() == 
+        stream.str().substr(0, types::r1cs_gg_ppzksnark_proof_serialized_size<scheme_proof_type, Endianness>()));
+}
+
+template<typename CurveGroup, 
+         typename Endianness>
+void test_curve_element_stream() {
+    using namespace nil::crypto3::marshalling;
+
+    using group_value_type = typename CurveGroup::value_type;
+    using curve_element_type = types::curve_element<
+        nil::marshalling::field_type<
+            Endianness>,
+        CurveGroup>;
+
+    const group_value_type point = nil::crypto3::algebra::random_element<CurveGroup>();
+
+    // Random points first, so the buffer wraps over their bytes before the
+    // infinity point, which writes only its flag byte, and the two signs of
+    // a point, one of which has the sign flag clear.
+    std::vector<group_value_type> vals;
+    for (unsigned i = 0; i < 7; ++i) {
+        vals.push_back(nil::crypto3::algebra::random_element<CurveGroup>());
+    }
+    vals.push_back(group_value_type::zero());
+    vals.push_back(point);
+    vals.push_back(-point);
+    vals.push_back(group_value_type::zero());
+
+    std::stringstream stream;
+    {
+        io::buffered_writer<io::ostream_device> writer(io::ostream_device(stream), 
+            3 * curve_element_type::max_length());
+        for (const group_value_type &val : vals) {
+            BOOST_CHECK(writer.write(curve_element_type(val)) == nil::marshalling::status_type::success);
+        }
+        writer.flush();
+    }
+
+    BOOST_CHECK(stream.str().size() == vals.size() * curve_element_type::max_length());
+
+    io::buffered_reader<io::istream_device> reader(io::istream_device(stream), 
+        3 * curve_element_type::max_length());
+    for (const group_value_type &val : vals) {
+        curve_element_type filled_val;
+        BOOST_CHECK(reader.read(filled_val, curve_element_type::max_length()) == 
+            nil::marshalling::status_type::success);
+        BOOST_CHECK(val == filled_val.value());
+    }
+}
+
+template<typename FieldType, 
+         typename Endianness>
+void test_field_element_vector_stream(std::size_t buffer_size) {
+    using namespace nil::crypto3::marshalling;
+
+    std::vector<typename FieldType::value_type> val;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        val.push_back(nil::crypto3::algebra::random_element<FieldType>());
+    }
+
+    auto filled_val = types::fill_field_element_vector<FieldType, Endianness>(val);
+    std::vector<std::uint8_t> cv(filled_val.length(), 0x00);
+    auto write_iter = cv.begin();
+    filled_val.write(write_iter, cv.size());
+
+    std::FILE *file = std::tmpfile();
+    BOOST_REQUIRE(file != nullptr);
+
+    BOOST_CHECK(io::write_buffered(filled_val, io::file_device(file), buffer_size) == 
+        nil::marshalling::status_type::success);
+    BOOST_CHECK(static_cast<std::size_t>(std::ftell(file)) == cv.size());
+
+    std::rewind(file);
+    std::vector<std::uint8_t> file_cv(cv.size() + 1);
+    BOOST_CHECK(std::fread(file_cv.data(), 1, file_cv.size(), file) == cv.size());
+    file_cv.pop_back();
+    BOOST_CHECK(file_cv == cv);
+
+    std::rewind(file);
+    decltype(filled_val) read_val;
+    BOOST_CHECK(io::read_buffered(read_val, io::fd_device(fileno(file)), cv.size(), buffer_size) == 
+        nil::marshalling::status_type::success);
+    BOOST_CHECK(val == types::construct_field_element_vector<FieldType, Endianness>(read_val));
+
+    std::fclose(file);
+
+    std::stringstream truncated_stream(std::string(cv.begin(), cv.end() - 1));
+    BOOST_CHECK(io::read_buffered(read_val, io::istream_device(truncated_stream), cv.size() - 1) != 
+        nil::marshalling::status_type::success);
+
+    // A size prefix larger than the input is rejected before reading elements
+    std::vector<std::uint8_t> oversized_cv(cv.begin(), cv.end());
+    std::fill_n(oversized_cv.begin(), 4, 0xFF);
+    std::stringstream oversized_stream(std::string(oversized_cv.begin(), oversized_cv.end()));
+    BOOST_CHECK(io::read_buffered(read_val, io::istream_device(oversized_stream), oversized_cv.size()) != 
+        nil::marshalling::status_type::success);
+}
+
+BOOST_AUTO_TEST_SUITE(buffered_stream_test_suite)
+
+BOOST_AUTO_TEST_CASE(proof_stream_bls12_381_be) {
+    test_proof_stream<nil::crypto3::zk::snark::r1cs_gg_ppzksnark<nil::crypto3::algebra::curves::bls12<381>>, 
+        nil::marshalling::option::big_endian>();
+}
+
+BOOST_AUTO_TEST_CASE(curve_element_stream_bls12_381_be) {
+    using curve_type = nil::crypto3::algebra::curves::bls12<381>;
+    test_curve_element_stream<typename curve_type::g1_type, nil::marshalling::option::big_endian>();
+    test_curve_element_stream<typename curve_type::g2_type, nil::marshalling::option::big_endian>();
+}
+
+BOOST_AUTO_TEST_CASE(field_element_vector_stream_bls12_381_be) {
+    using field_type = typename nil::crypto3::algebra::curves::bls12<381>::scalar_field_type;
+
+    test_field_element_vector_stream<field_type, nil::marshalling::option::big_endian>(
+        nil::crypto3::marshalling::io::default_buffer_size);
+    test_field_element_vector_stream<field_type, nil::marshalling::option::big_endian>(100);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
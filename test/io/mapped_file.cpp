@@ -0,0 +1,121 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE crypto3_marshalling_io_mapped_file_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+#include <iostream>
+#include <fstream>
+#include <cstdint>
+#include <vector>
+#include <system_error>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+
+#include <nil/crypto3/marshalling/types/algebra/field_element.hpp>
+#include <nil/crypto3/marshalling/io/buffered_writer.hpp>
+#include <nil/crypto3/marshalling/io/mapped_file.hpp>
+
+template<typename FieldType, 
+         typename Endianness>
+void test_mapped_field_element_vector() {
+    using namespace nil::crypto3::marshalling;
+
+    std::vector<typename FieldType::value_type> val;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        val.push_back(nil::crypto3::algebra::random_element<FieldType>());
+    }
+
+    auto filled_val = types::fill_field_element_vector<FieldType, Endianness>(val);
+
+    boost::filesystem::path file_path = 
+        boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    {
+        std::ofstream out(file_path.string(), std::ios::binary);
+        BOOST_CHECK(io::write_buffered(filled_val, io::ostream_device(out)) == 
+            nil::marshalling::status_type::success);
+    }
+
+    {
+        io::mapped_file file(file_path.string());
+        BOOST_CHECK(file.size() == filled_val.length());
+
+        decltype(filled_val) read_val;
+        auto read_iter = file.begin();
+        BOOST_CHECK(read_val.read(read_iter, file.size()) == nil::marshalling::status_type::success);
+        BOOST_CHECK(read_iter == file.end());
+        BOOST_CHECK(val == types::construct_field_element_vector<FieldType, Endianness>(read_val));
+
+        file.advise(io::mapped_file::access_pattern::random);
+
+        nil::marshalling::status_type status;
+        std::size_t size = file.size();
+        auto data_iter = file.begin();
+        BOOST_CHECK(val == 
+            types::read_field_element_vector_data<FieldType, Endianness>(data_iter, size, status));
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+        BOOST_CHECK(size == 0);
+        BOOST_CHECK(data_iter == file.end());
+
+        io::mapped_file moved_file(std::move(file));
+        BOOST_CHECK(file.data() == nullptr);
+        BOOST_CHECK(moved_file.size() == filled_val.length());
+    }
+
+    boost::filesystem::remove(file_path);
+}
+
+BOOST_AUTO_TEST_SUITE(mapped_file_test_suite)
+
+BOOST_AUTO_TEST_CASE(mapped_field_element_vector_bls12_381_be) {
+    using field_type = typename nil::crypto3::algebra::curves::bls12<381>::scalar_field_type;
+
+    test_mapped_field_element_vector<field_type, nil::marshalling::option::big_endian>();
+}
+
+BOOST_AUTO_TEST_CASE(mapped_empty_and_missing_file) {
+    using nil::crypto3::marshalling::io::mapped_file;
+
+    boost::filesystem::path file_path = 
+        boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    std::ofstream(file_path.string(), std::ios::binary).close();
+    {
+        mapped_file file(file_path.string());
+        BOOST_CHECK(file.size() == 0);
+        BOOST_CHECK(file.begin() == file.end());
+    }
+    boost::filesystem::remove(file_path);
+
+    BOOST_CHECK_THROW(mapped_file(file_path.string()), std::system_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
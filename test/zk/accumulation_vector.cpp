@@ -47,6 +47,7 @@
 #include <nil/crypto3/zk/snark/accumulation_vector.hpp>
 
 #include <nil/crypto3/marshalling/types/zk/accumulation_vector.hpp>
+#include <nil/crypto3/marshalling/types/zk/accumulation_vector_window_tables.hpp>
 
 template <typename TIter>
 void print_byteblob(TIter iter_begin, TIter iter_end){
@@ -147,6 +148,129 @@ void test_accumulation_vector() {
     }
 }
 
+template<typename CurveType, 
+         typename Endianness, 
+         std::size_t TSize>
+void test_accumulation_vector_window_tables() {
+    using namespace nil::crypto3::marshalling;
+
+    using group_type = typename CurveType::g1_type;
+    using scalar_field_type = typename CurveType::scalar_field_type;
+    using unit_type = unsigned char;
+    using accumulation_vector_window_tables_type = types::accumulation_vector_window_tables<
+        nil::marshalling::field_type<
+            Endianness>,
+        zk::snark::accumulation_vector<group_type>>;
+
+    constexpr static const std::size_t window = 4;
+
+    for (unsigned i = 0; i < 4; ++i) {
+        typename group_type::value_type first = 
+            nil::crypto3::algebra::random_element<group_type>();
+        std::vector<typename group_type::value_type> 
+            rest;
+        std::vector<typename scalar_field_type::value_type> 
+            primary_input;
+        for (std::size_t i=0; i<TSize; i++){
+            rest.push_back( 
+                nil::crypto3::algebra::random_element<group_type>());
+            primary_input.push_back( 
+                nil::crypto3::algebra::random_element<scalar_field_type>());
+        }
+        zk::snark::accumulation_vector<group_type> val(std::move(first), 
+                std::move(rest));
+
+        types::window_tables<group_type> tables = 
+            types::make_accumulation_vector_window_tables(val, 
+                scalar_field_type::modulus_bits, window);
+
+        accumulation_vector_window_tables_type filled_val = 
+            types::fill_accumulation_vector_window_tables<
+                zk::snark::accumulation_vector<group_type>,
+                Endianness>(tables);
+
+        std::vector<unit_type> cv;
+        cv.resize(filled_val.length(), 0x00);
+
+        auto write_iter = cv.begin();
+        nil::marshalling::status_type status =  
+            filled_val.write(write_iter, 
+                cv.size());
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+        accumulation_vector_window_tables_type test_val_read;
+
+        auto read_iter = cv.begin();
+        status = 
+            test_val_read.read(read_iter, 
+                    cv.size());
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+        types::window_tables<group_type> constructed_tables = 
+            types::construct_accumulation_vector_window_tables<
+                zk::snark::accumulation_vector<group_type>,
+                Endianness>(test_val_read, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+        BOOST_CHECK(tables == constructed_tables);
+
+        typename group_type::value_type accumulated = 
+            types::accumulate_with_window_tables<
+                zk::snark::accumulation_vector<group_type>, 
+                scalar_field_type>(val, constructed_tables, 
+                    primary_input.begin(), primary_input.end(), 0, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+        BOOST_CHECK(accumulated == 
+            val.accumulate_chunk(primary_input.begin(), primary_input.end(), 0).first);
+
+        // a chunk starting past the first input
+        typename group_type::value_type accumulated_chunk = 
+            types::accumulate_with_window_tables<
+                zk::snark::accumulation_vector<group_type>, 
+                scalar_field_type>(val, constructed_tables, 
+                    primary_input.begin() + 2, primary_input.end(), 2, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+        BOOST_CHECK(accumulated_chunk == 
+            val.accumulate_chunk(primary_input.begin() + 2, primary_input.end(), 2).first);
+
+        // a truncated last row
+        accumulation_vector_window_tables_type truncated_val = test_val_read;
+        std::get<2>(truncated_val.value()).value()[0].value().back().value().pop_back();
+        types::construct_accumulation_vector_window_tables<
+            zk::snark::accumulation_vector<group_type>,
+            Endianness>(truncated_val, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+
+        // a window that does not match the stored rows
+        accumulation_vector_window_tables_type mismatched_val = test_val_read;
+        std::get<1>(mismatched_val.value()).value() = window + 1;
+        types::construct_accumulation_vector_window_tables<
+            zk::snark::accumulation_vector<group_type>,
+            Endianness>(mismatched_val, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+
+        // tables that would drop the high bits of the scalars
+        types::window_tables<group_type> short_tables = 
+            types::make_accumulation_vector_window_tables(val, 
+                scalar_field_type::modulus_bits - 1, window);
+        types::accumulate_with_window_tables<
+            zk::snark::accumulation_vector<group_type>, 
+            scalar_field_type>(val, short_tables, 
+                primary_input.begin(), primary_input.end(), 0, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+
+        // tables built for another accumulation vector
+        types::window_tables<group_type> missing_tables = constructed_tables;
+        missing_tables.tables.pop_back();
+        types::accumulate_with_window_tables<
+            zk::snark::accumulation_vector<group_type>, 
+            scalar_field_type>(val, missing_tables, 
+                primary_input.begin(), primary_input.end(), 0, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(sparse_vector_test_suite)
 
 BOOST_AUTO_TEST_CASE(sparse_vector_bls12_381_g1_be) {
@@ -181,4 +305,12 @@ BOOST_AUTO_TEST_CASE(sparse_vector_bls12_381_g2_be) {
 //     std::cout << "BLS12-381 g2 group accumulation vector little-endian test finished" << std::endl;
 // }
 
+BOOST_AUTO_TEST_CASE(accumulation_vector_window_tables_bls12_381_g1_be) {
+    std::cout << "BLS12-381 g1 group accumulation vector window tables big-endian test started" << std::endl;
+    test_accumulation_vector_window_tables<nil::crypto3::algebra::curves::bls12<381>, 
+        nil::marshalling::option::big_endian, 
+        5>();
+    std::cout << "BLS12-381 g1 group accumulation vector window tables big-endian test finished" << std::endl;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -41,6 +41,11 @@
 #include <nil/crypto3/zk/snark/algorithms/prove.hpp>
 
 #include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+
+#include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/verifier_input.hpp>
+#include <nil/crypto3/marshalling/io/buffered_writer.hpp>
 
 using namespace nil::crypto3;
 using namespace nil::crypto3::zk;
@@ -64,8 +69,8 @@ int main(int argc, char *argv[]) {
     ("primary-input-output,pio", boost::program_options::value<boost::filesystem::path>(&piout)->default_value
 ("pinput"))
     ("proving-key-output,pko", boost::program_options::value<boost::filesystem::path>(&pkout)->default_value("pkey"))
-    ("verifying-key-output,vko", boost::program_options::value<boost::filesystem::path>(&viout)->default_value("vkey"))
-    ("verifier-input-output,vio", boost::program_options::value<boost::filesystem::path>(&vkout)->default_value("vio"));
+    ("verifying-key-output,vko", boost::program_options::value<boost::filesystem::path>(&vkout)->default_value("vkey"))
+    ("verifier-input-output,vio", boost::program_options::value<boost::filesystem::path>(&viout)->default_value("vio"));
     // clang-format on
 
     boost::program_options::variables_map vm;
@@ -123,34 +128,26 @@ int main(int argc, char *argv[]) {
         nil::marshalling::verifier_input_serializer_tvm<scheme_type>::process(example.primary_input);
 
     if (vm.count("proving-key-output")) {
-        boost::filesystem::ofstream out(pkout);
-        for (const auto &v : proving_key_byteblob) {
-            out << v;
-        }
+        boost::filesystem::ofstream out(pkout, std::ios_base::binary);
+        nil::crypto3::marshalling::io::ostream_device(out).write(proving_key_byteblob.data(), proving_key_byteblob.size());
         out.close();
     }
 
     if (vm.count("verifying-key-output")) {
-        boost::filesystem::ofstream out(vkout);
-        for (const auto &v : verification_key_byteblob) {
-            out << v;
-        }
+        boost::filesystem::ofstream out(vkout, std::ios_base::binary);
+        nil::crypto3::marshalling::io::ostream_device(out).write(verification_key_byteblob.data(), verification_key_byteblob.size());
         out.close();
     }
 
     if (vm.count("proof-output")) {
-        boost::filesystem::ofstream out(pout);
-        for (const auto &v : proof_byteblob) {
-            out << v;
-        }
+        boost::filesystem::ofstream out(pout, std::ios_base::binary);
+        nil::crypto3::marshalling::io::ostream_device(out).write(proof_byteblob.data(), proof_byteblob.size());
         out.close();
     }
 
     if (vm.count("primary-input-output")) {
-        boost::filesystem::ofstream out(piout);
-        for (const auto &v : primary_input_byteblob) {
-            out << v;
-        }
+        boost::filesystem::ofstream out(piout, std::ios_base::binary);
+        nil::crypto3::marshalling::io::ostream_device(out).write(primary_input_byteblob.data(), primary_input_byteblob.size());
         out.close();
     }
 
@@ -164,18 +161,21 @@ int main(int argc, char *argv[]) {
     // assert(keypair.first == other);
 
     if (vm.count("verifier-input-output")) {
-        std::vector<std::uint8_t> verifier_input_output_byteblob(proof_byteblob.begin(), proof_byteblob.end());
-
-        verifier_input_output_byteblob.insert(verifier_input_output_byteblob.end(), primary_input_byteblob.begin(),
-                                              primary_input_byteblob.end());
-        verifier_input_output_byteblob.insert(verifier_input_output_byteblob.end(), verification_key_byteblob.begin(),
-                                              verification_key_byteblob.end());
-
-        boost::filesystem::ofstream poutf(pout);
-        for (const auto &v : verifier_input_output_byteblob) {
-            poutf << v;
+        using endianness = nil::marshalling::option::big_endian;
+
+        auto filled_verifier_input =
+            nil::crypto3::marshalling::types::fill_r1cs_gg_ppzksnark_verifier_input<
+                typename scheme_type::verification_key_type, endianness>(proof, example.primary_input,
+                                                                         keypair.second);
+
+        boost::filesystem::ofstream vioutf(viout, std::ios_base::binary);
+        nil::marshalling::status_type status = nil::crypto3::marshalling::io::write_buffered(
+            filled_verifier_input, nil::crypto3::marshalling::io::ostream_device(vioutf));
+        if (status != nil::marshalling::status_type::success) {
+            std::cerr << "Verifier input serialization failed." << std::endl;
+            return 1;
         }
-        poutf.close();
+        vioutf.close();
     }
 
     return 0;
@@ -0,0 +1,213 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE crypto3_marshalling_r1cs_gg_ppzksnark_auxiliary_input_test
+
+#include <boost/test/unit_test.hpp>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+
+#include <nil/crypto3/zk/snark/schemes/ppzksnark/r1cs_gg_ppzksnark.hpp>
+
+#include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/auxiliary_input.hpp>
+
+template<typename FieldType, 
+         typename Endianness>
+void test_auxiliary_input(
+    const nil::crypto3::zk::snark::r1cs_auxiliary_input<FieldType> &val) {
+
+    using namespace nil::crypto3::marshalling;
+
+    using auxiliary_input_type = nil::crypto3::zk::snark::r1cs_auxiliary_input<FieldType>;
+    using unit_type = unsigned char;
+    using filled_auxiliary_input_type = types::r1cs_gg_ppzksnark_auxiliary_input<
+        nil::marshalling::field_type<
+            Endianness>,
+        auxiliary_input_type>;
+
+    filled_auxiliary_input_type filled_val = 
+        types::fill_r1cs_gg_ppzksnark_auxiliary_input<
+            auxiliary_input_type,
+            Endianness>(val);
+
+    BOOST_CHECK(filled_val.length() == 
+        types::r1cs_gg_ppzksnark_auxiliary_input_serialized_size<
+            auxiliary_input_type,
+            Endianness>(val));
+
+    std::vector<unit_type> cv;
+    cv.resize(filled_val.length(), 0x00);
+
+    auto write_iter = cv.begin();
+    nil::marshalling::status_type status =  
+        filled_val.write(write_iter, 
+            cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    filled_auxiliary_input_type test_val_read;
+
+    auto read_iter = cv.begin();
+    status = 
+        test_val_read.read(read_iter, 
+                cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    BOOST_CHECK(val == 
+        types::construct_r1cs_gg_ppzksnark_auxiliary_input<
+            auxiliary_input_type,
+            Endianness>(test_val_read));
+}
+
+template<typename FieldType, 
+         typename Endianness>
+void test_auxiliary_input_stream(
+    const nil::crypto3::zk::snark::r1cs_auxiliary_input<FieldType> &val, 
+    std::size_t chunk_size) {
+
+    using namespace nil::crypto3::marshalling;
+
+    using auxiliary_input_type = nil::crypto3::zk::snark::r1cs_auxiliary_input<FieldType>;
+
+    std::vector<std::uint8_t> stream;
+    std::size_t max_write_size = 0;
+    nil::marshalling::status_type status = 
+        types::write_r1cs_gg_ppzksnark_auxiliary_input_stream<
+            auxiliary_input_type, 
+            Endianness>(val, chunk_size, 
+                [&](const std::uint8_t *data, std::size_t size) {
+                    max_write_size = std::max(max_write_size, size);
+                    stream.insert(stream.end(), data, data + size);
+                    return nil::marshalling::status_type::success;
+                });
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    // A failing sink stops the stream after its first chunk
+    std::size_t sink_calls = 0;
+    status = 
+        types::write_r1cs_gg_ppzksnark_auxiliary_input_stream<
+            auxiliary_input_type, 
+            Endianness>(val, chunk_size, 
+                [&](const std::uint8_t *, std::size_t) {
+                    sink_calls++;
+                    return nil::marshalling::status_type::buffer_overflow;
+                });
+    BOOST_CHECK(status == nil::marshalling::status_type::buffer_overflow);
+    BOOST_CHECK(sink_calls == 1);
+
+    // A single chunk encodes exactly like the non-streaming type
+    if (val.size() <= chunk_size) {
+        auto filled_val = 
+            types::fill_r1cs_gg_ppzksnark_auxiliary_input<
+                auxiliary_input_type,
+                Endianness>(val);
+        BOOST_CHECK(max_write_size == filled_val.length());
+    }
+
+    // The source hands out at most 7 bytes per call
+    std::size_t pos = 0;
+    auto source = [&](std::uint8_t *data, std::size_t size) {
+        std::size_t read_size = std::min(std::min(size, std::size_t(7)), stream.size() - pos);
+        std::copy(stream.begin() + pos, stream.begin() + pos + read_size, data);
+        pos += read_size;
+        return read_size;
+    };
+
+    auxiliary_input_type read_val;
+    status = types::read_r1cs_gg_ppzksnark_auxiliary_input_stream<
+        FieldType, 
+        Endianness>(source, chunk_size, std::back_inserter(read_val));
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(pos == stream.size());
+    BOOST_CHECK(val == read_val);
+
+    if (chunk_size > 1 && val.size() > 1) {
+        pos = 0;
+        read_val.clear();
+        status = types::read_r1cs_gg_ppzksnark_auxiliary_input_stream<
+            FieldType, 
+            Endianness>(source, chunk_size - 1, std::back_inserter(read_val));
+        BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+    }
+
+    stream.pop_back();
+    pos = 0;
+    read_val.clear();
+    status = types::read_r1cs_gg_ppzksnark_auxiliary_input_stream<
+        FieldType, 
+        Endianness>(source, chunk_size, std::back_inserter(read_val));
+    BOOST_CHECK(status == nil::marshalling::status_type::not_enough_data);
+}
+
+template<typename FieldType, 
+         typename Endianness,
+         std::size_t TSize>
+void test_auxiliary_input() {
+    for (unsigned i = 0; i < 16; ++i) {
+        nil::crypto3::zk::snark::r1cs_auxiliary_input<FieldType> val;
+        for (std::size_t j = 0; j < TSize; j++) {
+            val.push_back(nil::crypto3::algebra::random_element<FieldType>());
+        }
+        test_auxiliary_input<FieldType, Endianness>(val);
+        test_auxiliary_input_stream<FieldType, Endianness>(val, 1);
+        test_auxiliary_input_stream<FieldType, Endianness>(val, 16);
+        test_auxiliary_input_stream<FieldType, Endianness>(val, TSize);
+        test_auxiliary_input_stream<FieldType, Endianness>(val, TSize + 1);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(r1cs_gg_ppzksnark_auxiliary_input_test_suite)
+
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_auxiliary_input_bls12_381_be) {
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark auxiliary input big-endian test started" << std::endl;
+    test_auxiliary_input<nil::crypto3::algebra::curves::bls12<381>::scalar_field_type, 
+        nil::marshalling::option::big_endian, 
+        100>();
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark auxiliary input big-endian test finished" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_auxiliary_input_bls12_381_le) {
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark auxiliary input little-endian test started" << std::endl;
+    test_auxiliary_input<nil::crypto3::algebra::curves::bls12<381>::scalar_field_type, 
+        nil::marshalling::option::little_endian, 
+        100>();
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark auxiliary input little-endian test finished" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -105,6 +105,30 @@ void test_primary_input(
         filled_val.write(write_iter, 
             cv.size());
 
+    BOOST_CHECK(unitblob_size == 
+        types::r1cs_gg_ppzksnark_primary_input_serialized_size<
+            typename SchemeType::primary_input_type,
+            Endianness>(val));
+
+    std::vector<unit_type> single_pass_cv(unitblob_size);
+    auto single_pass_iter = single_pass_cv.begin();
+    types::write_r1cs_gg_ppzksnark_primary_input_data<
+        typename SchemeType::primary_input_type,
+        Endianness>(val, single_pass_iter);
+    BOOST_CHECK(single_pass_iter == single_pass_cv.end());
+    BOOST_CHECK(cv == single_pass_cv);
+
+    auto single_pass_read_iter = cv.cbegin();
+    std::size_t single_pass_read_size = cv.size();
+    typename SchemeType::primary_input_type 
+        single_pass_val_read = 
+        types::read_r1cs_gg_ppzksnark_primary_input_data<
+            typename SchemeType::primary_input_type,
+            Endianness>(single_pass_read_iter, single_pass_read_size, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(single_pass_read_iter == cv.cend());
+    BOOST_CHECK(val == single_pass_val_read);
+
     primary_input_type test_val_read;
 
     auto read_iter = cv.begin();
@@ -143,6 +167,179 @@ void test_primary_input() {
     }
 }
 
+template<typename SchemeType, 
+         typename Endianness>
+void test_packed_primary_input(
+    const typename SchemeType::primary_input_type &val, 
+    std::size_t expected_packed_count) {
+
+    using namespace nil::crypto3::marshalling;
+
+    using unit_type = unsigned char;
+    using packed_primary_input_type = types::r1cs_gg_ppzksnark_packed_primary_input<
+        nil::marshalling::field_type<
+            Endianness>,
+        typename SchemeType::primary_input_type>;
+
+    packed_primary_input_type filled_val = 
+        types::fill_r1cs_gg_ppzksnark_packed_primary_input<
+            typename SchemeType::primary_input_type,
+            Endianness>(val);
+
+    BOOST_CHECK(std::get<3>(filled_val.value()).value().size() == 
+        val.size() - expected_packed_count);
+    BOOST_CHECK(std::get<2>(filled_val.value()).value().size() == 
+        (expected_packed_count + 7) / 8);
+    if (expected_packed_count == val.size()) {
+        BOOST_CHECK(std::get<1>(filled_val.value()).value().empty());
+    }
+
+    std::vector<unit_type> cv;
+    cv.resize(filled_val.length(), 0x00);
+
+    auto write_iter = cv.begin();
+    nil::marshalling::status_type status =  
+        filled_val.write(write_iter, 
+            cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    packed_primary_input_type test_val_read;
+
+    auto read_iter = cv.begin();
+    status = 
+        test_val_read.read(read_iter, 
+                cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    typename SchemeType::primary_input_type 
+        constructed_val_read = 
+        types::construct_r1cs_gg_ppzksnark_packed_primary_input<
+            typename SchemeType::primary_input_type,
+            Endianness>(test_val_read, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    BOOST_CHECK(val == 
+        constructed_val_read);
+
+    if (expected_packed_count % 8 != 0) {
+        auto &last_bits = std::get<2>(test_val_read.value()).value().back();
+        last_bits.value() |= std::uint8_t(1u << 7);
+        types::construct_r1cs_gg_ppzksnark_packed_primary_input<
+            typename SchemeType::primary_input_type,
+            Endianness>(test_val_read, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+    }
+}
+
+template<typename SchemeType, 
+         typename Endianness>
+void test_declared_packed_primary_input(
+    const typename SchemeType::primary_input_type &val, 
+    const std::vector<bool> &boolean_mask) {
+
+    using namespace nil::crypto3::marshalling;
+
+    using unit_type = unsigned char;
+    using packed_primary_input_type = types::r1cs_gg_ppzksnark_packed_primary_input<
+        nil::marshalling::field_type<
+            Endianness>,
+        typename SchemeType::primary_input_type>;
+
+    nil::marshalling::status_type status;
+    packed_primary_input_type filled_val = 
+        types::fill_r1cs_gg_ppzksnark_packed_primary_input<
+            typename SchemeType::primary_input_type,
+            Endianness>(val, boolean_mask, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(std::get<1>(filled_val.value()).value().empty());
+
+    std::vector<unit_type> cv;
+    cv.resize(filled_val.length(), 0x00);
+
+    auto write_iter = cv.begin();
+    status = 
+        filled_val.write(write_iter, 
+            cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    packed_primary_input_type test_val_read;
+
+    auto read_iter = cv.begin();
+    status = 
+        test_val_read.read(read_iter, 
+                cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    typename SchemeType::primary_input_type 
+        constructed_val_read = 
+        types::construct_r1cs_gg_ppzksnark_packed_primary_input<
+            typename SchemeType::primary_input_type,
+            Endianness>(test_val_read, boolean_mask, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    BOOST_CHECK(val == 
+        constructed_val_read);
+
+    // a mask differing from the declared one does not match the planes
+    std::vector<bool> flipped_mask = boolean_mask;
+    flipped_mask.front() = !flipped_mask.front();
+    types::construct_r1cs_gg_ppzksnark_packed_primary_input<
+        typename SchemeType::primary_input_type,
+        Endianness>(test_val_read, flipped_mask, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+
+    // declaring a non-boolean input as boolean is rejected
+    for (std::size_t i = 0; i < val.size(); i++) {
+        if (!boolean_mask[i] && 
+            val[i] != SchemeType::primary_input_type::value_type::zero() && 
+            val[i] != SchemeType::primary_input_type::value_type::one()) {
+            std::vector<bool> wrong_mask = boolean_mask;
+            wrong_mask[i] = true;
+            types::fill_r1cs_gg_ppzksnark_packed_primary_input<
+                typename SchemeType::primary_input_type,
+                Endianness>(val, wrong_mask, status);
+            BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+            break;
+        }
+    }
+}
+
+template<typename SchemeType, 
+         typename Endianness,
+         std::size_t TSize>
+void test_packed_primary_input() {
+    using field_type = typename SchemeType::primary_input_type::value_type::field_type;
+    using field_value_type = typename field_type::value_type;
+
+    boost::random::mt19937 rng;
+    boost::random::uniform_int_distribution<> bit_dist(0, 1);
+    boost::random::uniform_int_distribution<> kind_dist(0, 3);
+
+    for (unsigned i = 0; i < 128; ++i) {
+        typename SchemeType::primary_input_type bits_only, mixed;
+        std::vector<bool> mixed_mask;
+        std::size_t mixed_packed_count = 0;
+        for (std::size_t j = 0; j < TSize; j++) {
+            bits_only.push_back(bit_dist(rng) ? field_value_type::one() : field_value_type::zero());
+            mixed_mask.push_back(kind_dist(rng) != 0);
+            if (mixed_mask.back()) {
+                mixed.push_back(bit_dist(rng) ? field_value_type::one() : field_value_type::zero());
+                mixed_packed_count++;
+            } else {
+                // random elements are practically never 0 or 1
+                field_value_type input = nil::crypto3::algebra::random_element<field_type>();
+                if (input == field_value_type::zero() || input == field_value_type::one()) {
+                    mixed_packed_count++;
+                }
+                mixed.push_back(input);
+            }
+        }
+        test_packed_primary_input<SchemeType, Endianness>(bits_only, TSize);
+        test_packed_primary_input<SchemeType, Endianness>(mixed, mixed_packed_count);
+        test_declared_packed_primary_input<SchemeType, Endianness>(mixed, mixed_mask);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(r1cs_gg_ppzksnark_primary_input_test_suite)
 
 BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_primary_input_bls12_381_be) {
@@ -161,4 +358,15 @@ BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_primary_input_bls12_381_le) {
     std::cout << "BLS12-381 r1cs_gg_ppzksnark primary input little-endian test finished" << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_packed_primary_input_bls12_381_be) {
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark packed primary input big-endian test started" << std::endl;
+    test_packed_primary_input<nil::crypto3::zk::snark::r1cs_gg_ppzksnark<nil::crypto3::algebra::curves::bls12<381>>, 
+        nil::marshalling::option::big_endian, 
+        256>();
+    test_packed_primary_input<nil::crypto3::zk::snark::r1cs_gg_ppzksnark<nil::crypto3::algebra::curves::bls12<381>>, 
+        nil::marshalling::option::big_endian, 
+        13>();
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark packed primary input big-endian test finished" << std::endl;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,158 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE crypto3_marshalling_r1cs_gg_ppzksnark_processed_verification_key_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <iostream>
+#include <iomanip>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+
+#include <nil/crypto3/zk/snark/sparse_vector.hpp>
+#include <nil/crypto3/zk/snark/accumulation_vector.hpp>
+
+#include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/processed_verification_key.hpp>
+
+template<typename Endianness, 
+         typename CurveType>
+void test_processed_verification_key(
+    zk::snark::r1cs_gg_ppzksnark_processed_verification_key<CurveType> val) {
+
+    using namespace nil::crypto3::marshalling;
+
+    using unit_type = unsigned char;
+    using processed_verification_key_type = types::r1cs_gg_ppzksnark_processed_verification_key<
+        nil::marshalling::field_type<
+            Endianness>,
+        zk::snark::r1cs_gg_ppzksnark_processed_verification_key<CurveType>>;
+
+    processed_verification_key_type filled_val = 
+        types::fill_r1cs_gg_ppzksnark_processed_verification_key<
+            zk::snark::r1cs_gg_ppzksnark_processed_verification_key<CurveType>,
+            Endianness>(val);
+
+    zk::snark::r1cs_gg_ppzksnark_processed_verification_key<CurveType> 
+        constructed_val = 
+        types::construct_r1cs_gg_ppzksnark_processed_verification_key<
+            zk::snark::r1cs_gg_ppzksnark_processed_verification_key<CurveType>,
+            Endianness>(filled_val);
+    BOOST_CHECK(val == constructed_val);
+
+    std::size_t unitblob_size = 
+        filled_val.length();
+    BOOST_CHECK(unitblob_size == 
+        types::r1cs_gg_ppzksnark_processed_verification_key_serialized_size<
+            zk::snark::r1cs_gg_ppzksnark_processed_verification_key<CurveType>,
+            Endianness>(val));
+
+    std::vector<unit_type> cv;
+    cv.resize(unitblob_size, 0x00);
+
+    auto write_iter = cv.begin();
+
+    nil::marshalling::status_type status =  
+        filled_val.write(write_iter, 
+            cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    processed_verification_key_type test_val_read;
+
+    auto read_iter = cv.begin();
+    status = 
+        test_val_read.read(read_iter, 
+                cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    zk::snark::r1cs_gg_ppzksnark_processed_verification_key<CurveType> 
+        constructed_val_read = 
+        types::construct_r1cs_gg_ppzksnark_processed_verification_key<
+            zk::snark::r1cs_gg_ppzksnark_processed_verification_key<CurveType>,
+            Endianness>(test_val_read);
+
+    BOOST_CHECK(val == 
+        constructed_val_read);
+}
+
+template<typename CurveType, 
+         typename Endianness, 
+         std::size_t TSize>
+void test_processed_verification_key() {
+    using g1_type = typename CurveType::g1_type;
+    using g2_type = typename CurveType::g2_type;
+    using gt_type = typename CurveType::gt_type;
+
+    std::cout << std::hex;
+    std::cerr << std::hex;
+    for (unsigned i = 0; i < 16; ++i) {
+        if (!(i%4) && i){
+            std::cout << std::dec << i << " tested" << std::endl;
+        }
+        typename g1_type::value_type first = 
+            nil::crypto3::algebra::random_element<g1_type>();
+        std::vector<typename g1_type::value_type> 
+            rest;
+        for (std::size_t i=0; i<TSize; i++){
+            rest.push_back( 
+                nil::crypto3::algebra::random_element<g1_type>());
+        }
+
+        zk::snark::r1cs_gg_ppzksnark_processed_verification_key<CurveType> val;
+        val.vk_alpha_g1_beta_g2 = nil::crypto3::algebra::random_element<gt_type>();
+        val.vk_gamma_g2_precomp = nil::crypto3::algebra::precompute_g2<CurveType>(
+            nil::crypto3::algebra::random_element<g2_type>());
+        val.vk_delta_g2_precomp = nil::crypto3::algebra::precompute_g2<CurveType>(
+            nil::crypto3::algebra::random_element<g2_type>());
+        val.gamma_ABC_g1 = zk::snark::accumulation_vector<g1_type>(std::move(first), 
+            std::move(rest));
+
+        test_processed_verification_key<Endianness, CurveType>(val);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(processed_verification_key_test_suite)
+
+BOOST_AUTO_TEST_CASE(processed_verification_key_bls12_381_be) {
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark processed verification key big-endian test started" << std::endl;
+    test_processed_verification_key<nil::crypto3::algebra::curves::bls12<381>, 
+        nil::marshalling::option::big_endian, 
+        5>();
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark processed verification key big-endian test finished" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -31,6 +31,12 @@
 #include <boost/random/uniform_int.hpp>
 #include <iostream>
 #include <iomanip>
+#include <array>
+#include <list>
+#include <sstream>
+#include <string>
+#include <iterator>
+#include <algorithm>
 
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/field_type.hpp>
@@ -45,6 +51,7 @@
 
 #include <nil/crypto3/zk/snark/schemes/ppzksnark/r1cs_gg_ppzksnark.hpp>
 
+#include <nil/crypto3/marshalling/types/integral.hpp>
 #include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/proof.hpp>
 
 template <typename TIter>
@@ -144,6 +151,107 @@ void test_proof() {
     }
 }
 
+template<typename SchemeType, 
+         typename Endianness>
+void test_proof_array() {
+    using namespace nil::crypto3::marshalling;
+
+    using scheme_proof_type = typename SchemeType::proof_type;
+    using curve_type = typename scheme_proof_type::curve_type;
+    using proof_type = types::r1cs_gg_ppzksnark_proof<
+        nil::marshalling::field_type<
+            Endianness>,
+        scheme_proof_type>;
+
+    constexpr std::size_t serialized_size = 
+        types::r1cs_gg_ppzksnark_proof_serialized_size<scheme_proof_type, Endianness>();
+    static_assert(serialized_size == proof_type::max_length(), 
+        "proof serialized size mismatch");
+
+    for (unsigned i = 0; i < 128; ++i) {
+        scheme_proof_type val(
+            nil::crypto3::algebra::random_element<typename curve_type::g1_type>(), 
+            nil::crypto3::algebra::random_element<typename curve_type::g2_type>(), 
+            nil::crypto3::algebra::random_element<typename curve_type::g1_type>());
+
+        std::array<std::uint8_t, serialized_size> blob = 
+            types::write_r1cs_gg_ppzksnark_proof<scheme_proof_type, Endianness>(val);
+
+        proof_type filled_val = 
+            types::fill_r1cs_gg_ppzksnark_proof<
+                scheme_proof_type,
+                Endianness>(val);
+        std::vector<unsigned char> cv(filled_val.length(), 0x00);
+        auto write_iter = cv.begin();
+        filled_val.write(write_iter, cv.size());
+
+        BOOST_CHECK(std::equal(blob.begin(), blob.end(), cv.begin(), cv.end()));
+
+        BOOST_CHECK(val == 
+            types::read_r1cs_gg_ppzksnark_proof<scheme_proof_type, Endianness>(blob));
+
+        std::vector<unsigned char> appended_cv;
+        auto append_iter = std::back_inserter(appended_cv);
+        filled_val.write(append_iter, serialized_size);
+
+        BOOST_CHECK(appended_cv == cv);
+
+        appended_cv.clear();
+        append_iter = std::back_inserter(appended_cv);
+        types::write_r1cs_gg_ppzksnark_proof_data<scheme_proof_type, Endianness>(val, append_iter);
+
+        BOOST_CHECK(appended_cv == cv);
+
+        std::list<unsigned char> list_cv(cv.begin(), cv.end());
+        auto list_iter = list_cv.cbegin();
+        proof_type list_val;
+        BOOST_CHECK(list_val.read(list_iter, serialized_size) == 
+            nil::marshalling::status_type::success);
+        BOOST_CHECK(list_iter == list_cv.cend());
+
+        BOOST_CHECK(val == 
+            types::construct_r1cs_gg_ppzksnark_proof<scheme_proof_type, Endianness>(list_val));
+
+        // single-pass input
+        std::istringstream proof_stream(std::string(cv.begin(), cv.end()));
+        std::istreambuf_iterator<char> proof_stream_iter(proof_stream);
+        proof_type stream_val;
+        BOOST_CHECK(stream_val.read(proof_stream_iter, serialized_size) == 
+            nil::marshalling::status_type::success);
+        BOOST_CHECK(proof_stream_iter == std::istreambuf_iterator<char>());
+
+        BOOST_CHECK(val == 
+            types::construct_r1cs_gg_ppzksnark_proof<scheme_proof_type, Endianness>(stream_val));
+    }
+
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using number_type = types::field_coordinate_type<scalar_field_type>;
+    using integral_type = types::integral<
+        nil::marshalling::field_type<
+            Endianness>,
+        number_type>;
+
+    for (unsigned i = 0; i < 128; ++i) {
+        integral_type integral_val(number_type(
+            nil::crypto3::algebra::random_element<scalar_field_type>().data));
+
+        std::vector<unsigned char> integral_cv;
+        auto integral_append_iter = std::back_inserter(integral_cv);
+        BOOST_CHECK(integral_val.write(integral_append_iter, integral_type::max_length()) == 
+            nil::marshalling::status_type::success);
+        BOOST_CHECK(integral_cv.size() == integral_type::max_length());
+
+        std::istringstream integral_stream(std::string(integral_cv.begin(), integral_cv.end()));
+        std::istreambuf_iterator<char> integral_stream_iter(integral_stream);
+        integral_type integral_stream_val;
+        BOOST_CHECK(integral_stream_val.read(integral_stream_iter, integral_type::max_length()) == 
+            nil::marshalling::status_type::success);
+        BOOST_CHECK(integral_stream_iter == std::istreambuf_iterator<char>());
+
+        BOOST_CHECK(integral_val.value() == integral_stream_val.value());
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(proof_test_suite)
 
 BOOST_AUTO_TEST_CASE(proof_bls12_381_be) {
@@ -153,6 +261,13 @@ BOOST_AUTO_TEST_CASE(proof_bls12_381_be) {
     std::cout << "BLS12-381 r1cs_gg_ppzksnark proof big-endian test finished" << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(proof_array_bls12_381_be) {
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark proof std::array big-endian test started" << std::endl;
+    test_proof_array<nil::crypto3::zk::snark::r1cs_gg_ppzksnark<nil::crypto3::algebra::curves::bls12<381>>, 
+        nil::marshalling::option::big_endian>();
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark proof std::array big-endian test finished" << std::endl;
+}
+
 // BOOST_AUTO_TEST_CASE(proof_bls12_381_le) {
 //     std::cout << "BLS12-381 r1cs_gg_ppzksnark proof little-endian test started" << std::endl;
 //     test_proof<nil::crypto3::zk::snark::r1cs_gg_ppzksnark<nil::crypto3::algebra::curves::bls12<381>>, 
@@ -0,0 +1,176 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE crypto3_marshalling_r1cs_gg_ppzksnark_proof_batch_test
+
+#include <boost/test/unit_test.hpp>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+
+#include <nil/crypto3/zk/snark/schemes/ppzksnark/r1cs_gg_ppzksnark.hpp>
+
+#include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/proof_batch.hpp>
+
+template<typename SchemeType, 
+         typename Endianness>
+void test_proof_batch(
+    const std::vector<typename SchemeType::proof_type> &proofs,
+    const std::vector<typename SchemeType::primary_input_type> &primary_inputs) {
+
+    using namespace nil::crypto3::marshalling;
+
+    using proof_type = typename SchemeType::proof_type;
+    using unit_type = unsigned char;
+    using proof_batch_type = types::r1cs_gg_ppzksnark_proof_batch<
+        nil::marshalling::field_type<
+            Endianness>,
+        proof_type>;
+
+    proof_batch_type filled_val = 
+        types::fill_r1cs_gg_ppzksnark_proof_batch<
+            proof_type,
+            Endianness>(proofs, primary_inputs);
+
+    types::r1cs_gg_ppzksnark_proof_batch_planes<proof_type> constructed_val = 
+        types::construct_r1cs_gg_ppzksnark_proof_batch<
+            proof_type,
+            Endianness>(filled_val);
+
+    BOOST_CHECK(constructed_val.size() == proofs.size());
+    for (std::size_t i = 0; i < proofs.size(); i++) {
+        BOOST_CHECK(constructed_val.proof(i) == proofs[i]);
+        BOOST_CHECK(constructed_val.primary_inputs[i] == primary_inputs[i]);
+    }
+
+    BOOST_CHECK(filled_val.length() == 
+        types::r1cs_gg_ppzksnark_proof_batch_serialized_size<
+            proof_type,
+            Endianness>(constructed_val));
+
+    std::vector<unit_type> cv;
+    cv.resize(filled_val.length(), 0x00);
+
+    auto write_iter = cv.begin();
+    nil::marshalling::status_type status = 
+        filled_val.write(write_iter, 
+            cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    proof_batch_type test_val_read;
+
+    auto read_iter = cv.begin();
+    status = 
+        test_val_read.read(read_iter, 
+            cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    types::r1cs_gg_ppzksnark_proof_batch_planes<proof_type> constructed_val_read = 
+        types::construct_r1cs_gg_ppzksnark_proof_batch<
+            proof_type,
+            Endianness>(test_val_read);
+
+    types::r1cs_gg_ppzksnark_proof_batch_planes<proof_type> planes_read = 
+        types::read_r1cs_gg_ppzksnark_proof_batch<
+            proof_type,
+            Endianness>(cv.cbegin(), cv.size(), status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    for (std::size_t i = 0; i < proofs.size(); i++) {
+        BOOST_CHECK(constructed_val_read.proof(i) == proofs[i]);
+        BOOST_CHECK(constructed_val_read.primary_inputs[i] == primary_inputs[i]);
+        BOOST_CHECK(planes_read.proof(i) == proofs[i]);
+        BOOST_CHECK(planes_read.primary_inputs[i] == primary_inputs[i]);
+    }
+
+    if (!cv.empty()) {
+        types::read_r1cs_gg_ppzksnark_proof_batch<
+            proof_type,
+            Endianness>(cv.cbegin(), cv.size() - 1, status);
+        BOOST_CHECK(status != nil::marshalling::status_type::success);
+    }
+}
+
+template<typename SchemeType, 
+         typename Endianness, 
+         std::size_t BatchSize, 
+         std::size_t PrimaryInputSize>
+void test_proof_batch() {
+    using proof_type = typename SchemeType::proof_type;
+    using curve_type = typename proof_type::curve_type;
+
+    std::cout << std::hex;
+    std::cerr << std::hex;
+    for (unsigned i = 0; i < 8; ++i) {
+        std::vector<proof_type> proofs;
+        std::vector<typename SchemeType::primary_input_type> primary_inputs;
+
+        for (std::size_t j = 0; j < BatchSize; ++j) {
+            proofs.emplace_back(
+                nil::crypto3::algebra::random_element<typename curve_type::g1_type>(), 
+                nil::crypto3::algebra::random_element<typename curve_type::g2_type>(), 
+                nil::crypto3::algebra::random_element<typename curve_type::g1_type>());
+
+            typename SchemeType::primary_input_type primary_input;
+            for (std::size_t k = 0; k < PrimaryInputSize; ++k) {
+                primary_input.push_back(
+                    nil::crypto3::algebra::random_element<
+                        typename curve_type::scalar_field_type>());
+            }
+            primary_inputs.push_back(primary_input);
+        }
+
+        test_proof_batch<SchemeType, Endianness>(proofs, primary_inputs);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(proof_batch_test_suite)
+
+BOOST_AUTO_TEST_CASE(proof_batch_bls12_381_be) {
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark proof batch big-endian test started" << std::endl;
+    test_proof_batch<nil::crypto3::zk::snark::r1cs_gg_ppzksnark<nil::crypto3::algebra::curves::bls12<381>>, 
+        nil::marshalling::option::big_endian, 16, 4>();
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark proof batch big-endian test finished" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(proof_batch_empty_bls12_381_be) {
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark empty proof batch big-endian test started" << std::endl;
+    test_proof_batch<nil::crypto3::zk::snark::r1cs_gg_ppzksnark<nil::crypto3::algebra::curves::bls12<381>>, 
+        nil::marshalling::option::big_endian, 0, 4>();
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark empty proof batch big-endian test finished" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
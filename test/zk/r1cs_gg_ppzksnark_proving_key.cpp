@@ -0,0 +1,151 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE crypto3_marshalling_r1cs_gg_ppzksnark_proving_key_test
+
+#include <boost/test/unit_test.hpp>
+#include <iostream>
+#include <vector>
+#include <future>
+#include <cstdint>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/bls12.hpp>
+
+#include <nil/crypto3/zk/snark/schemes/ppzksnark/r1cs_gg_ppzksnark.hpp>
+#include <nil/crypto3/zk/snark/algorithms/generate.hpp>
+
+#include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/proving_key.hpp>
+
+#include "detail/r1cs_examples.hpp"
+
+using namespace nil::crypto3;
+
+template<typename CurveType, 
+         typename Endianness>
+void test_proving_key() {
+    using namespace nil::crypto3::marshalling;
+
+    using scheme_type = zk::snark::r1cs_gg_ppzksnark<CurveType>;
+    using proving_key_type = typename scheme_type::proving_key_type;
+    using field_type = typename CurveType::scalar_field_type;
+    using unit_type = unsigned char;
+    using section_type = types::r1cs_gg_ppzksnark_proving_key_section;
+
+    zk::snark::r1cs_example<field_type> example = 
+        zk::snark::generate_r1cs_example_with_field_input<field_type>(20, 5);
+    typename scheme_type::keypair_type keypair = 
+        zk::snark::generate<scheme_type>(example.constraint_system);
+    const proving_key_type &pk = keypair.first;
+
+    auto filled_val = 
+        types::fill_r1cs_gg_ppzksnark_proving_key<proving_key_type, Endianness>(pk);
+    nil::marshalling::status_type construct_status;
+    BOOST_CHECK(pk == 
+        types::construct_r1cs_gg_ppzksnark_proving_key<proving_key_type, Endianness>(
+            filled_val, pk.constraint_system, construct_status));
+    BOOST_CHECK(construct_status == nil::marshalling::status_type::success);
+
+    auto malformed_val = filled_val;
+    std::get<2>(std::get<3>(malformed_val.value()).value()).value().pop_back();
+    types::construct_r1cs_gg_ppzksnark_proving_key<proving_key_type, Endianness>(
+        malformed_val, pk.constraint_system, construct_status);
+    BOOST_CHECK(construct_status == nil::marshalling::status_type::invalid_msg_data);
+
+    malformed_val = filled_val;
+    std::get<0>(std::get<3>(malformed_val.value()).value()).value().pop_back();
+    types::construct_r1cs_gg_ppzksnark_proving_key<proving_key_type, Endianness>(
+        malformed_val, pk.constraint_system, construct_status);
+    BOOST_CHECK(construct_status == nil::marshalling::status_type::invalid_msg_data);
+
+    BOOST_CHECK(filled_val.length() == 
+        types::r1cs_gg_ppzksnark_proving_key_serialized_size<proving_key_type, Endianness>(pk));
+
+    std::vector<unit_type> cv(filled_val.length(), 0x00);
+    auto write_iter = cv.begin();
+    nil::marshalling::status_type status = filled_val.write(write_iter, cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    types::r1cs_gg_ppzksnark_proving_key<
+        nil::marshalling::field_type<Endianness>, 
+        proving_key_type> test_val_read;
+    auto read_iter = cv.cbegin();
+    status = test_val_read.read(read_iter, cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(pk == 
+        types::construct_r1cs_gg_ppzksnark_proving_key<proving_key_type, Endianness>(
+            test_val_read, pk.constraint_system, construct_status));
+    BOOST_CHECK(construct_status == nil::marshalling::status_type::success);
+
+    types::section_descriptor H_query_section = 
+        types::read_r1cs_gg_ppzksnark_proving_key_section<Endianness>(
+            cv.cbegin(), cv.size(), section_type::H_query, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(H_query_section.count == pk.H_query.size());
+    BOOST_CHECK(H_query_section.size == std::get<4>(filled_val.value()).length());
+
+    auto read_query = [&cv](section_type section, nil::marshalling::status_type &query_status) {
+        return types::read_r1cs_gg_ppzksnark_proving_key_query<proving_key_type, Endianness>(
+            cv.cbegin(), cv.size(), section, query_status);
+    };
+    nil::marshalling::status_type A_status, H_status, L_status;
+    auto A_query = std::async(std::launch::async, read_query, section_type::A_query, std::ref(A_status));
+    auto H_query = std::async(std::launch::async, read_query, section_type::H_query, std::ref(H_status));
+    auto L_query = std::async(std::launch::async, read_query, section_type::L_query, std::ref(L_status));
+    BOOST_CHECK(A_query.get() == pk.A_query);
+    BOOST_CHECK(H_query.get() == pk.H_query);
+    BOOST_CHECK(L_query.get() == pk.L_query);
+    BOOST_CHECK(A_status == nil::marshalling::status_type::success);
+    BOOST_CHECK(H_status == nil::marshalling::status_type::success);
+    BOOST_CHECK(L_status == nil::marshalling::status_type::success);
+
+    BOOST_CHECK(pk.B_query == 
+        types::read_r1cs_gg_ppzksnark_proving_key_b_query<proving_key_type, Endianness>(
+            cv.cbegin(), cv.size(), status));
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    read_query(section_type::fixed, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+
+    types::read_r1cs_gg_ppzksnark_proving_key_query<proving_key_type, Endianness>(
+        cv.cbegin(), H_query_section.offset, section_type::H_query, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+}
+
+BOOST_AUTO_TEST_SUITE(r1cs_gg_ppzksnark_proving_key_test_suite)
+
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_proving_key_bls12_381_be) {
+    test_proving_key<algebra::curves::bls12<381>, nil::marshalling::option::big_endian>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,193 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE crypto3_marshalling_r1cs_gg_ppzksnark_proving_key_image_test
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/bls12.hpp>
+
+#include <nil/crypto3/zk/snark/schemes/ppzksnark/r1cs_gg_ppzksnark.hpp>
+#include <nil/crypto3/zk/snark/algorithms/generate.hpp>
+
+#include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/proving_key_image.hpp>
+
+#include "detail/r1cs_examples.hpp"
+
+using namespace nil::crypto3;
+
+template<typename G1Span, typename Points>
+void check_g1_section(const G1Span &span, const Points &points) {
+    BOOST_CHECK(span.size() == points.size());
+    BOOST_CHECK(reinterpret_cast<std::uintptr_t>(span.data()) % 64 == 0 || span.empty());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        BOOST_CHECK(span.get(i) == points[i]);
+    }
+}
+
+template<typename ProvingKey>
+void check_proving_key_image(const marshalling::types::r1cs_gg_ppzksnark_proving_key_image<ProvingKey> &image, 
+                             const ProvingKey &pk) {
+    BOOST_CHECK(image.alpha_g1() == pk.alpha_g1);
+    BOOST_CHECK(image.beta_g1() == pk.beta_g1);
+    BOOST_CHECK(image.delta_g1() == pk.delta_g1);
+    BOOST_CHECK(image.beta_g2() == pk.beta_g2);
+    BOOST_CHECK(image.delta_g2() == pk.delta_g2);
+
+    check_g1_section(image.A_query(), pk.A_query);
+    check_g1_section(image.H_query(), pk.H_query);
+    check_g1_section(image.L_query(), pk.L_query);
+
+    BOOST_CHECK(image.B_query_size() == pk.B_query.indices.size());
+    BOOST_CHECK(image.B_query_domain_size() == pk.B_query.domain_size_);
+    for (std::size_t i = 0; i < pk.B_query.indices.size(); i++) {
+        BOOST_CHECK(image.B_query_indices()[i] == pk.B_query.indices[i]);
+        BOOST_CHECK(image.B_query_g1().get(i) == pk.B_query.values[i].h);
+        BOOST_CHECK(image.B_query_g2().get(i) == pk.B_query.values[i].g);
+    }
+}
+
+template<typename CurveGroup>
+void test_affine_point_layout() {
+    using layout_type = marshalling::types::affine_point_layout<CurveGroup>;
+    using value_type = typename CurveGroup::value_type;
+    using limb_type = typename layout_type::limb_type;
+
+    for (std::size_t i = 0; i < 16; i++) {
+        value_type point = algebra::random_element<CurveGroup>();
+        // Both a projective and an already affine point
+        for (const value_type &p : {point, point.to_affine()}) {
+            std::vector<limb_type> limbs(layout_type::point_limbs, 0);
+            layout_type::write(p, limbs.data());
+            BOOST_CHECK(layout_type::read(limbs.data()) == p);
+        }
+    }
+
+    std::vector<limb_type> limbs(layout_type::point_limbs, 0);
+    layout_type::write(value_type::zero(), limbs.data());
+    BOOST_CHECK(std::all_of(limbs.begin(), limbs.end(), 
+        [](limb_type limb) { return limb == 0; }));
+    BOOST_CHECK(layout_type::read(limbs.data()).is_zero());
+}
+
+template<typename CurveType>
+void test_proving_key_image() {
+    using scheme_type = zk::snark::r1cs_gg_ppzksnark<CurveType>;
+    using proving_key_type = typename scheme_type::proving_key_type;
+    using field_type = typename CurveType::scalar_field_type;
+
+    zk::snark::r1cs_example<field_type> example = 
+        zk::snark::generate_r1cs_example_with_field_input<field_type>(20, 5);
+    typename scheme_type::keypair_type keypair = 
+        zk::snark::generate<scheme_type>(example.constraint_system);
+    const proving_key_type &pk = keypair.first;
+
+    std::vector<std::uint8_t> image_bytes = 
+        marshalling::types::write_r1cs_gg_ppzksnark_proving_key_image(pk);
+    BOOST_CHECK(image_bytes.size() == 
+        marshalling::types::r1cs_gg_ppzksnark_proving_key_image_size(pk));
+
+    marshalling::types::r1cs_gg_ppzksnark_proving_key_image<proving_key_type> image;
+    BOOST_CHECK(image.open(image_bytes.data(), image_bytes.size()) == 
+        nil::marshalling::status_type::success);
+    check_proving_key_image(image, pk);
+
+    BOOST_CHECK(image.open(image_bytes.data(), image_bytes.size() - 64) == 
+        nil::marshalling::status_type::not_enough_data);
+
+    std::vector<std::uint8_t> corrupted_bytes = image_bytes;
+    corrupted_bytes.back() ^= 0x01;
+    BOOST_CHECK(image.open(corrupted_bytes.data(), corrupted_bytes.size()) == 
+        nil::marshalling::status_type::invalid_msg_data);
+    BOOST_CHECK(image.open(corrupted_bytes.data(), corrupted_bytes.size(), false) == 
+        nil::marshalling::status_type::success);
+
+    using entry_type = marshalling::types::r1cs_gg_ppzksnark_proving_key_image_section_entry;
+    const std::size_t sections_offset = 
+        sizeof(marshalling::types::r1cs_gg_ppzksnark_proving_key_image_header);
+
+    // A section pointing into the header and section table
+    std::vector<std::uint8_t> overlapping_bytes = image_bytes;
+    entry_type entry;
+    std::memcpy(&entry, overlapping_bytes.data() + sections_offset, sizeof(entry));
+    entry.offset = 0;
+    std::memcpy(overlapping_bytes.data() + sections_offset, &entry, sizeof(entry));
+    BOOST_CHECK(image.open(overlapping_bytes.data(), overlapping_bytes.size(), false) == 
+        nil::marshalling::status_type::invalid_msg_data);
+
+    // The second section overlapping the first one
+    overlapping_bytes = image_bytes;
+    std::memcpy(&entry, overlapping_bytes.data() + sections_offset, sizeof(entry));
+    entry_type second_entry;
+    std::memcpy(&second_entry, overlapping_bytes.data() + sections_offset + sizeof(entry), 
+        sizeof(second_entry));
+    second_entry.offset = entry.offset;
+    std::memcpy(overlapping_bytes.data() + sections_offset + sizeof(entry), &second_entry, 
+        sizeof(second_entry));
+    BOOST_CHECK(image.open(overlapping_bytes.data(), overlapping_bytes.size(), false) == 
+        nil::marshalling::status_type::invalid_msg_data);
+
+    boost::filesystem::path image_path = 
+        boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    {
+        std::ofstream out(image_path.string(), std::ios::binary);
+        out.write(reinterpret_cast<const char *>(image_bytes.data()), image_bytes.size());
+    }
+    {
+        marshalling::types::mapped_r1cs_gg_ppzksnark_proving_key_image<proving_key_type> 
+            mapped_image(image_path.string());
+        BOOST_CHECK(mapped_image.open() == nil::marshalling::status_type::success);
+        check_proving_key_image(mapped_image, pk);
+    }
+    boost::filesystem::remove(image_path);
+}
+
+BOOST_AUTO_TEST_SUITE(r1cs_gg_ppzksnark_proving_key_image_test_suite)
+
+BOOST_AUTO_TEST_CASE(affine_point_layout_bls12_381) {
+    test_affine_point_layout<algebra::curves::bls12<381>::g1_type>();
+    test_affine_point_layout<algebra::curves::bls12<381>::g2_type>();
+}
+
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_proving_key_image_bls12_381) {
+    test_proving_key_image<algebra::curves::bls12<381>>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -31,6 +31,7 @@
 #include <boost/random/uniform_int.hpp>
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/field_type.hpp>
@@ -47,6 +48,7 @@
 #include <nil/crypto3/zk/snark/accumulation_vector.hpp>
 
 #include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/verification_key.hpp>
+#include <nil/crypto3/marshalling/types/parallel_bundle.hpp>
 
 template <typename TIter>
 void print_byteblob(TIter iter_begin, TIter iter_end){
@@ -106,6 +108,66 @@ void test_verification_key(
         filled_val.write(write_iter, 
             cv.size());
 
+    BOOST_CHECK(unitblob_size == 
+        types::r1cs_gg_ppzksnark_verification_key_serialized_size<
+            zk::snark::r1cs_gg_ppzksnark_verification_key<CurveType>,
+            Endianness>(val));
+
+    std::vector<unit_type> single_pass_cv(unitblob_size);
+    auto single_pass_iter = single_pass_cv.begin();
+    types::write_r1cs_gg_ppzksnark_verification_key_data<
+        zk::snark::r1cs_gg_ppzksnark_verification_key<CurveType>,
+        Endianness>(val, single_pass_iter);
+    BOOST_CHECK(single_pass_iter == single_pass_cv.end());
+    BOOST_CHECK(cv == single_pass_cv);
+
+    auto single_pass_read_iter = cv.cbegin();
+    std::size_t single_pass_read_size = cv.size();
+    zk::snark::r1cs_gg_ppzksnark_verification_key<CurveType> 
+        single_pass_val_read = 
+        types::read_r1cs_gg_ppzksnark_verification_key_data<
+            zk::snark::r1cs_gg_ppzksnark_verification_key<CurveType>,
+            Endianness>(single_pass_read_iter, single_pass_read_size, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(single_pass_read_iter == cv.cend());
+    BOOST_CHECK(single_pass_read_size == 0);
+    BOOST_CHECK(val == single_pass_val_read);
+
+    auto truncated_read_iter = cv.cbegin();
+    std::size_t truncated_read_size = cv.size() - 1;
+    types::read_r1cs_gg_ppzksnark_verification_key_data<
+        zk::snark::r1cs_gg_ppzksnark_verification_key<CurveType>,
+        Endianness>(truncated_read_iter, truncated_read_size, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::not_enough_data);
+
+    std::vector<unit_type> parallel_cv(unitblob_size, 0x00);
+    auto parallel_write_iter = parallel_cv.begin();
+    status = types::write_bundle_parallel(filled_val, parallel_write_iter, parallel_cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(parallel_write_iter == parallel_cv.end());
+    BOOST_CHECK(cv == parallel_cv);
+
+    // every member in its own task
+    std::fill(parallel_cv.begin(), parallel_cv.end(), 0x00);
+    parallel_write_iter = parallel_cv.begin();
+    status = types::write_bundle_parallel(filled_val, parallel_write_iter, parallel_cv.size(), 0);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(parallel_write_iter == parallel_cv.end());
+    BOOST_CHECK(cv == parallel_cv);
+
+    for (std::size_t min_task_length : {types::detail::parallel_bundle_min_task_length, std::size_t(0)}) {
+        verification_key_type parallel_val_read;
+        auto parallel_read_iter = cv.cbegin();
+        status = types::read_bundle_parallel(parallel_val_read, parallel_read_iter, cv.size(), 
+            min_task_length);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+        BOOST_CHECK(parallel_read_iter == cv.cend());
+        BOOST_CHECK(val == 
+            types::construct_r1cs_gg_ppzksnark_verification_key<
+                zk::snark::r1cs_gg_ppzksnark_verification_key<CurveType>,
+                Endianness>(parallel_val_read));
+    }
+
     verification_key_type test_val_read;
 
     auto read_iter = cv.begin();
@@ -155,6 +217,86 @@ void test_verification_key() {
     }
 }
 
+template<typename CurveType, 
+         typename Endianness, 
+         std::size_t TSize, 
+         std::size_t PrefixSize>
+void test_partial_verification_key() {
+    using namespace nil::crypto3::marshalling;
+
+    using g1_type = typename CurveType::g1_type;
+    using g2_type = typename CurveType::g2_type;
+    using gt_type = typename CurveType::gt_type;
+    using scalar_field_type = typename CurveType::scalar_field_type;
+    using verification_key_type = zk::snark::r1cs_gg_ppzksnark_verification_key<CurveType>;
+
+    using unit_type = unsigned char;
+    using partial_verification_key_type = types::r1cs_gg_ppzksnark_partial_verification_key<
+        nil::marshalling::field_type<
+            Endianness>,
+        verification_key_type>;
+
+    for (unsigned i = 0; i < 16; ++i) {
+        typename g1_type::value_type first = 
+            nil::crypto3::algebra::random_element<g1_type>();
+        std::vector<typename g1_type::value_type> 
+            rest;
+        std::vector<typename scalar_field_type::value_type> 
+            primary_input;
+        for (std::size_t i=0; i<TSize; i++){
+            rest.push_back( 
+                nil::crypto3::algebra::random_element<g1_type>());
+            primary_input.push_back( 
+                nil::crypto3::algebra::random_element<scalar_field_type>());
+        }
+        verification_key_type val(
+            nil::crypto3::algebra::random_element<gt_type>(), 
+            nil::crypto3::algebra::random_element<g2_type>(), 
+            nil::crypto3::algebra::random_element<g2_type>(), 
+            std::move(zk::snark::accumulation_vector<g1_type>(std::move(first), 
+                std::move(rest))));
+
+        partial_verification_key_type filled_val = 
+            types::fill_r1cs_gg_ppzksnark_partial_verification_key<
+                verification_key_type,
+                Endianness>(val, primary_input.begin(), primary_input.begin() + PrefixSize);
+
+        std::vector<unit_type> cv;
+        cv.resize(filled_val.length(), 0x00);
+
+        auto write_iter = cv.begin();
+        nil::marshalling::status_type status =  
+            filled_val.write(write_iter, 
+                cv.size());
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+        partial_verification_key_type test_val_read;
+
+        auto read_iter = cv.begin();
+        status = 
+            test_val_read.read(read_iter, 
+                    cv.size());
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+        std::pair<verification_key_type, std::size_t> constructed_val_read = 
+            types::construct_r1cs_gg_ppzksnark_partial_verification_key<
+                verification_key_type,
+                Endianness>(test_val_read);
+
+        BOOST_CHECK(constructed_val_read.second == PrefixSize);
+        BOOST_CHECK(constructed_val_read.first.gamma_ABC_g1.rest.indices.size() == TSize - PrefixSize);
+
+        BOOST_CHECK(constructed_val_read.first.gamma_ABC_g1.accumulate_chunk(
+                        primary_input.begin() + constructed_val_read.second, 
+                        primary_input.end(), 
+                        constructed_val_read.second).first == 
+                    val.gamma_ABC_g1.accumulate_chunk(
+                        primary_input.begin(), 
+                        primary_input.end(), 
+                        0).first);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(sparse_vector_test_suite)
 
 BOOST_AUTO_TEST_CASE(sparse_vector_bls12_381_be) {
@@ -173,4 +315,13 @@ BOOST_AUTO_TEST_CASE(sparse_vector_bls12_381_be) {
 //     std::cout << "BLS12-381 r1cs_gg_ppzksnark verification key little-endian test finished" << std::endl;
 // }
 
+BOOST_AUTO_TEST_CASE(partial_verification_key_bls12_381_be) {
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark partial verification key big-endian test started" << std::endl;
+    test_partial_verification_key<nil::crypto3::algebra::curves::bls12<381>, 
+        nil::marshalling::option::big_endian, 
+        5, 
+        2>();
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark partial verification key big-endian test finished" << std::endl;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
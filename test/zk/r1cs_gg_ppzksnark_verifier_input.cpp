@@ -0,0 +1,191 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE crypto3_marshalling_r1cs_gg_ppzksnark_verifier_input_test
+
+#include <boost/test/unit_test.hpp>
+#include <iostream>
+#include <iomanip>
+#include <tuple>
+#include <vector>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+
+#include <nil/crypto3/zk/snark/sparse_vector.hpp>
+#include <nil/crypto3/zk/snark/accumulation_vector.hpp>
+#include <nil/crypto3/zk/snark/schemes/ppzksnark/r1cs_gg_ppzksnark.hpp>
+
+#include <nil/crypto3/marshalling/types/zk/r1cs_gg_ppzksnark/verifier_input.hpp>
+
+using namespace nil::crypto3;
+
+template<typename CurveType, 
+         typename Endianness, 
+         std::size_t TSize>
+void test_verifier_input() {
+    using namespace nil::crypto3::marshalling;
+
+    using g1_type = typename CurveType::g1_type;
+    using g2_type = typename CurveType::g2_type;
+    using gt_type = typename CurveType::gt_type;
+    using scalar_field_type = typename CurveType::scalar_field_type;
+
+    using proof_type = zk::snark::r1cs_gg_ppzksnark_proof<CurveType>;
+    using primary_input_type = zk::snark::r1cs_primary_input<scalar_field_type>;
+    using verification_key_type = zk::snark::r1cs_gg_ppzksnark_verification_key<CurveType>;
+
+    using TTypeBase = nil::marshalling::field_type<Endianness>;
+    using unit_type = unsigned char;
+    using verifier_input_type = types::r1cs_gg_ppzksnark_verifier_input<
+        TTypeBase,
+        verification_key_type>;
+
+    for (unsigned i = 0; i < 16; ++i) {
+        typename g1_type::value_type first = 
+            nil::crypto3::algebra::random_element<g1_type>();
+        std::vector<typename g1_type::value_type> 
+            rest;
+        primary_input_type primary_input;
+        for (std::size_t j=0; j<TSize; j++){
+            rest.push_back( 
+                nil::crypto3::algebra::random_element<g1_type>());
+            primary_input.push_back( 
+                nil::crypto3::algebra::random_element<scalar_field_type>());
+        }
+        verification_key_type verification_key(
+            nil::crypto3::algebra::random_element<gt_type>(), 
+            nil::crypto3::algebra::random_element<g2_type>(), 
+            nil::crypto3::algebra::random_element<g2_type>(), 
+            std::move(zk::snark::accumulation_vector<g1_type>(std::move(first), 
+                std::move(rest))));
+        proof_type proof(
+            nil::crypto3::algebra::random_element<g1_type>(), 
+            nil::crypto3::algebra::random_element<g2_type>(), 
+            nil::crypto3::algebra::random_element<g1_type>());
+
+        verifier_input_type filled_val = 
+            types::fill_r1cs_gg_ppzksnark_verifier_input<
+                verification_key_type,
+                Endianness>(proof, primary_input, verification_key);
+
+        BOOST_CHECK(filled_val.length() == 
+            types::r1cs_gg_ppzksnark_verifier_input_serialized_size<
+                verification_key_type,
+                Endianness>(primary_input, verification_key));
+
+        std::vector<unit_type> cv;
+        cv.resize(filled_val.length(), 0x00);
+
+        auto write_iter = cv.begin();
+        nil::marshalling::status_type status =  
+            filled_val.write(write_iter, 
+                cv.size());
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+        verifier_input_type test_val_read;
+
+        auto read_iter = cv.begin();
+        status = 
+            test_val_read.read(read_iter, 
+                    cv.size());
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+        auto constructed_val_read = 
+            types::construct_r1cs_gg_ppzksnark_verifier_input<
+                verification_key_type,
+                Endianness>(test_val_read);
+
+        BOOST_CHECK(std::get<0>(constructed_val_read) == proof);
+        BOOST_CHECK(std::get<1>(constructed_val_read) == primary_input);
+        BOOST_CHECK(std::get<2>(constructed_val_read) == verification_key);
+
+        // Each section decodes on its own from the offset stored in the header
+        std::pair<std::size_t, std::size_t> proof_section = 
+            types::read_r1cs_gg_ppzksnark_verifier_input_section<Endianness>(
+                cv.cbegin(), cv.size(), 
+                types::r1cs_gg_ppzksnark_verifier_input_section::proof, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+        types::r1cs_gg_ppzksnark_proof<TTypeBase, proof_type> proof_read;
+        read_iter = cv.begin() + proof_section.first;
+        status = proof_read.read(read_iter, proof_section.second);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+        BOOST_CHECK(types::construct_r1cs_gg_ppzksnark_proof<proof_type, Endianness>(proof_read) == proof);
+
+        std::pair<std::size_t, std::size_t> primary_input_section = 
+            types::read_r1cs_gg_ppzksnark_verifier_input_section<Endianness>(
+                cv.cbegin(), cv.size(), 
+                types::r1cs_gg_ppzksnark_verifier_input_section::primary_input, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+        types::r1cs_gg_ppzksnark_primary_input<TTypeBase, primary_input_type> primary_input_read;
+        read_iter = cv.begin() + primary_input_section.first;
+        status = primary_input_read.read(read_iter, primary_input_section.second);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+        BOOST_CHECK(types::construct_r1cs_gg_ppzksnark_primary_input<primary_input_type, Endianness>(
+                        primary_input_read) == primary_input);
+
+        std::pair<std::size_t, std::size_t> verification_key_section = 
+            types::read_r1cs_gg_ppzksnark_verifier_input_section<Endianness>(
+                cv.cbegin(), cv.size(), 
+                types::r1cs_gg_ppzksnark_verifier_input_section::verification_key, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+        BOOST_CHECK(verification_key_section.first + verification_key_section.second == cv.size());
+
+        types::r1cs_gg_ppzksnark_verification_key<TTypeBase, verification_key_type> verification_key_read;
+        read_iter = cv.begin() + verification_key_section.first;
+        status = verification_key_read.read(read_iter, verification_key_section.second);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+        BOOST_CHECK(types::construct_r1cs_gg_ppzksnark_verification_key<verification_key_type, Endianness>(
+                        verification_key_read) == verification_key);
+
+        // A truncated blob must not yield a section running past its end
+        types::read_r1cs_gg_ppzksnark_verifier_input_section<Endianness>(
+            cv.cbegin(), cv.size() - 1, 
+            types::r1cs_gg_ppzksnark_verifier_input_section::verification_key, status);
+        BOOST_CHECK(status != nil::marshalling::status_type::success);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(verifier_input_test_suite)
+
+BOOST_AUTO_TEST_CASE(verifier_input_bls12_381_be) {
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark verifier input big-endian test started" << std::endl;
+    test_verifier_input<nil::crypto3::algebra::curves::bls12<381>, 
+        nil::marshalling::option::big_endian, 
+        5>();
+    std::cout << "BLS12-381 r1cs_gg_ppzksnark verifier input big-endian test finished" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
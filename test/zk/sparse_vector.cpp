@@ -31,6 +31,8 @@
 #include <boost/random/uniform_int.hpp>
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <cstdint>
 
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/field_type.hpp>
@@ -122,6 +124,76 @@ void test_sparse_vector(
         constructed_val_read);
 }
 
+template<typename Endianness, 
+         typename GroupType>
+void test_sparse_vector_coordinate_planes(
+    const zk::snark::sparse_vector<GroupType> &val) {
+
+    using namespace nil::crypto3::marshalling;
+
+    using unit_type = unsigned char;
+    using planes_type = types::curve_element_coordinate_planes<GroupType>;
+
+    std::vector<unit_type> cv(
+        types::sparse_vector_serialized_size<
+            zk::snark::sparse_vector<GroupType>,
+            Endianness>(val));
+    auto write_iter = cv.begin();
+    types::write_sparse_vector_data<
+        zk::snark::sparse_vector<GroupType>,
+        Endianness>(val, write_iter);
+
+    nil::marshalling::status_type status;
+    auto read_iter = cv.cbegin();
+    std::size_t read_size = cv.size();
+    types::sparse_vector_coordinate_planes<GroupType> planes_read = 
+        types::read_sparse_vector_coordinate_planes_data<
+            zk::snark::sparse_vector<GroupType>,
+            Endianness>(read_iter, read_size, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(read_size == 0);
+    BOOST_CHECK(planes_read.indices == val.indices);
+    BOOST_CHECK(planes_read.domain_size_ == val.domain_size_);
+    BOOST_CHECK(planes_read.values.size() == val.values.size());
+
+    BOOST_CHECK(planes_type::stride % (planes_type::alignment / sizeof(typename planes_type::limb_type)) == 0);
+    BOOST_CHECK(reinterpret_cast<std::uintptr_t>(planes_read.values.x_plane()) % 
+        planes_type::alignment == 0);
+    BOOST_CHECK(reinterpret_cast<std::uintptr_t>(planes_read.values.y_plane()) % 
+        planes_type::alignment == 0);
+    for (std::size_t i = 0; i < val.values.size(); i++){
+        BOOST_CHECK(planes_read.values.x(i) == 
+            planes_read.values.x_plane() + i * planes_type::stride);
+        BOOST_CHECK(planes_read.values.get(i) == val.values[i]);
+    }
+
+    planes_type filled_planes = 
+        types::fill_curve_element_coordinate_planes<GroupType>(val.values);
+    BOOST_CHECK(std::equal(filled_planes.x_plane(), 
+                           filled_planes.x_plane() + val.values.size() * planes_type::stride, 
+                           planes_read.values.x_plane()));
+    BOOST_CHECK(std::equal(filled_planes.y_plane(), 
+                           filled_planes.y_plane() + val.values.size() * planes_type::stride, 
+                           planes_read.values.y_plane()));
+}
+
+template<typename GroupType, 
+         typename Endianness, 
+         std::size_t TSize>
+void test_sparse_vector_coordinate_planes() {
+    for (unsigned i = 0; i < 16; ++i) {
+        std::vector<typename GroupType::value_type> 
+            val_container;
+        for (std::size_t i=0; i<TSize; i++){
+            val_container.push_back( 
+                nil::crypto3::algebra::random_element<GroupType>().to_affine());
+        }
+        val_container.push_back(GroupType::value_type::zero());
+        test_sparse_vector_coordinate_planes<Endianness>(
+            zk::snark::sparse_vector<GroupType>(std::move(val_container)));
+    }
+}
+
 template<typename GroupType, 
          typename Endianness, 
          std::size_t TSize>
@@ -161,6 +233,12 @@ BOOST_AUTO_TEST_CASE(sparse_vector_bls12_381_g1_be) {
 //     std::cout << "BLS12-381 g1 group field sparse vector little-endian test finished" << std::endl;
 // }
 
+BOOST_AUTO_TEST_CASE(sparse_vector_coordinate_planes_bls12_381_g1_be) {
+    test_sparse_vector_coordinate_planes<nil::crypto3::algebra::curves::bls12<381>::g1_type, 
+        nil::marshalling::option::big_endian, 
+        5>();
+}
+
 BOOST_AUTO_TEST_CASE(sparse_vector_bls12_381_g2_be) {
     std::cout << "BLS12-381 g2 group field sparse vector big-endian test started" << std::endl;
     test_sparse_vector<nil::crypto3::algebra::curves::bls12<381>::g2_type, 